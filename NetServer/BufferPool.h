@@ -0,0 +1,56 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+// Pooled, growable byte buffers for per-session receive storage
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace GsNet {
+// 세션 수신 버퍼 풀
+// 세션마다 고정 64KB를 들고 있는 대신 작은 버퍼로 시작해서 필요할 때만
+// 늘리고, 세션 종료 시 반납해서 다음 접속자가 재사용함
+class BufferPool {
+public:
+  static constexpr size_t MAX_POOLED_BUFFERS = 1024;
+
+  static BufferPool &Get() {
+    static BufferPool Instance;
+    return Instance;
+  }
+
+  // 최소 MinCapacity 만큼 공간이 확보된 빈 버퍼를 꺼냄
+  std::vector<uint8_t> Acquire(size_t MinCapacity) {
+    std::vector<uint8_t> Buffer;
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      if (!FreeBuffers.empty()) {
+        Buffer = std::move(FreeBuffers.back());
+        FreeBuffers.pop_back();
+      }
+    }
+    Buffer.reserve(MinCapacity);
+    return Buffer;
+  }
+
+  // 버퍼 반납 (용량은 유지, 내용은 비움)
+  void Release(std::vector<uint8_t> &&Buffer) {
+    if (Buffer.capacity() == 0) {
+      return;
+    }
+    Buffer.clear();
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (FreeBuffers.size() < MAX_POOLED_BUFFERS) {
+      FreeBuffers.push_back(std::move(Buffer));
+    }
+  }
+
+private:
+  BufferPool() = default;
+
+  std::mutex Mutex;
+  std::vector<std::vector<uint8_t>> FreeBuffers;
+};
+} // namespace GsNet
@@ -0,0 +1,65 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+// Lock-free Multi-Producer Single-Consumer Queue
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace GsNet {
+// 여러 스레드가 Push, 한 스레드(소유자)만 Pop 하는 무잠금 큐
+// (Vyukov 방식: Push는 exchange 1회, Pop은 원자적 RMW 없음)
+template <typename T> class MpscQueue {
+public:
+  MpscQueue() {
+    Node *stub = new Node();
+    Head.store(stub, std::memory_order_relaxed);
+    Tail = stub;
+  }
+
+  ~MpscQueue() {
+    T dummy;
+    while (Pop(dummy)) {
+    }
+    delete Tail;
+  }
+
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+
+  // 모든 스레드에서 호출 가능
+  void Push(T Value) {
+    Node *node = new Node();
+    node->Value = std::move(Value);
+    Node *prev = Head.exchange(node, std::memory_order_acq_rel);
+    prev->Next.store(node, std::memory_order_release);
+  }
+
+  // 소유 스레드에서만 호출
+  bool Pop(T &OutValue) {
+    Node *tail = Tail;
+    Node *next = tail->Next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return false;
+    }
+    OutValue = std::move(next->Value);
+    Tail = next;
+    delete tail;
+    return true;
+  }
+
+  // 소유 스레드에서만 호출
+  bool IsEmpty() const {
+    return Tail->Next.load(std::memory_order_acquire) == nullptr;
+  }
+
+private:
+  struct Node {
+    std::atomic<Node *> Next{nullptr};
+    T Value{};
+  };
+
+  std::atomic<Node *> Head;
+  Node *Tail;
+};
+} // namespace GsNet
@@ -3,9 +3,16 @@
 
 #pragma once
 
+#include "BufferPool.h"
 #include "Crypto.h"
+#include "Protocol.h"
 #include <WinSock2.h>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 
 namespace GsNet {
@@ -19,31 +26,77 @@ enum class RecvMode {
 struct ClientSession {
   SOCKET Socket = INVALID_SOCKET;
   uint32_t SessionId = 0;
-  ServerCrypto Crypto;
+  ServerCrypto Crypto; // TX는 SendMutex, RX는 RecvMutex를 잡은 수신 스레드만
 
-  // 수신 버퍼
-  static constexpr int RECV_BUFFER_SIZE = 64 * 1024;
-  uint8_t RecvBuffer[RECV_BUFFER_SIZE];
+  // 수신 스레드가 연결이 끝날 때까지 잡고 있음
+  // 세션 재개 시 이전 연결의 수신 스레드가 빠져나간 뒤에 RX 상태를 인수하기 위함
+  std::timed_mutex RecvMutex;
+
+  // 수신 버퍼 (풀에서 빌려오고 패킷 크기에 맞춰 필요할 때만 늘림)
+  static constexpr int INITIAL_RECV_BUFFER_SIZE = 256;
+  static constexpr int MAX_PACKET_SIZE = 4096;
+  std::vector<uint8_t> RecvBuffer;
   int RecvOffset = 0;
   int ExpectedSize = 0;
   RecvMode Mode = RecvMode::Header;
 
-  // 핸드셰이크 상태
-  bool bHandshakeComplete = false;
+  // 핸드셰이크 상태 (다른 세션 스레드에서 락 없이 읽음)
+  std::atomic<bool> bHandshakeComplete{false};
   int HandshakeRecvOffset = 0;
 
   // 마지막 위치 (새 접속자 동기화용)
-  float LastX = 0, LastY = 0, LastZ = 0;
-  float LastYaw = 0;
+  // 자기 스레드만 쓰고 스냅샷 생성 시 락 없이 읽음. 필드 간 찢어진 값은
+  // 다음 이동 브로드캐스트에서 바로 보정되므로 허용
+  std::atomic<float> LastX{0}, LastY{0}, LastZ{0};
+  std::atomic<float> LastYaw{0};
+
+  // 소속 존 (ZoneManager가 핸드오프 시 갱신, I/O 스레드가 라우팅에 사용)
+  static constexpr uint32_t INVALID_ZONE = UINT32_MAX;
+  std::atomic<uint32_t> ZoneId{INVALID_ZONE};
+
+  // 이동 순번: 수신 스레드가 매기고, 존 스레드는 마지막으로 중계한 순번보다
+  // 오래된 이동(핸드오프 중 예전 존에서 넘어온 것)을 버림
+  uint32_t MoveSequence = 0;
+  std::atomic<uint32_t> LastRelayedMove{0};
+
+  // 송신 직렬화 (TxNonce 증가 순서 = 실제 전송 순서가 되어야 함)
+  std::mutex SendMutex;
+
+  // 세션 재개: 로그인한 세션은 끊겨도 유예 시간 동안 월드에 남고,
+  // 토큰을 가진 새 연결이 소켓/암호화 상태만 갈아끼워 이어서 사용함
+  static constexpr int RESUME_GRACE_SECONDS = 10;
+  uint8_t ResumeToken[RESUME_TOKEN_SIZE] = {};
+  std::atomic<uint32_t> ConnectionSerial{0}; // 연결이 바뀔 때마다 증가
+
+  // 아래는 SendMutex로 보호
+  bool bResumable = false; // 로그인 완료 ~ 유예 만료 전
+  bool bSuspended = false; // 연결 끊김, 재개 대기 중
+  std::chrono::steady_clock::time_point SuspendDeadline;
+  std::map<uint32_t, SnapshotEntry> MissedEnters; // 유예 중 입장 (최신 위치)
+  std::set<uint32_t> MissedLeaves;                // 유예 중 퇴장
+
+  ClientSession()
+      : RecvBuffer(BufferPool::Get().Acquire(INITIAL_RECV_BUFFER_SIZE)) {}
 
-  ClientSession() { memset(RecvBuffer, 0, RECV_BUFFER_SIZE); }
+  ~ClientSession() { BufferPool::Get().Release(std::move(RecvBuffer)); }
+
+  ClientSession(const ClientSession &) = delete;
+  ClientSession &operator=(const ClientSession &) = delete;
 
   // 수신 버퍼 초기화
   void ResetRecvBuffer() {
     RecvOffset = 0;
     ExpectedSize = 0;
     Mode = RecvMode::Header;
-    memset(RecvBuffer, 0, RECV_BUFFER_SIZE);
+  }
+
+  // 최소 Size 바이트를 담을 수 있는 수신 버퍼 포인터 반환
+  // 늘어나면 포인터가 바뀌므로 호출 후 다시 받아서 써야 함 (기존 내용은 유지)
+  uint8_t *GrowRecvBuffer(int Size) {
+    if ((int)RecvBuffer.size() < Size) {
+      RecvBuffer.resize(Size);
+    }
+    return RecvBuffer.data();
   }
 
   // 세션 초기화
@@ -122,6 +175,15 @@ struct ClientSession {
       return false;
     }
 
+    // 여러 스레드(브로드캐스트, 로그인 응답)가 동시에 보낼 수 있음
+    std::lock_guard<std::mutex> lock(SendMutex);
+
+    // 유예 중에는 보내지 않고 재개 시 보낼 델타만 기록
+    if (bSuspended) {
+      RecordMissed(data, len);
+      return true;
+    }
+
     // 데이터 복사 후 암호화
     std::vector<uint8_t> buffer(data, data + len);
 
@@ -151,9 +213,152 @@ struct ClientSession {
     return (bytesSent == len);
   }
 
+  // 로그인 완료: 재개 토큰 발급 (OutToken으로 복사)
+  void EnableResume(uint8_t *OutToken) {
+    std::lock_guard<std::mutex> lock(SendMutex);
+    randombytes_buf(ResumeToken, RESUME_TOKEN_SIZE);
+    memcpy(OutToken, ResumeToken, RESUME_TOKEN_SIZE);
+    bResumable = true;
+  }
+
+  // 연결 종료 처리. 재개 가능한 세션이면 유예 상태로 전환
+  // 반환값: true면 호출자가 세션을 테이블에서 제거해야 함
+  // (Serial이 바뀌었으면 이미 다른 연결이 인수했으므로 아무것도 안 함)
+  bool CloseConnection(uint32_t Serial) {
+    std::lock_guard<std::mutex> lock(SendMutex);
+    if (ConnectionSerial != Serial) {
+      return false;
+    }
+    if (!bResumable) {
+      return true;
+    }
+    bSuspended = true;
+    SuspendDeadline = std::chrono::steady_clock::now() +
+                      std::chrono::seconds(RESUME_GRACE_SECONDS);
+    MissedEnters.clear();
+    MissedLeaves.clear();
+    return false;
+  }
+
+  // 유예 시간이 지났으면 재개 불가로 전환 (true면 호출자가 제거 + 퇴장 알림)
+  bool TryExpire(std::chrono::steady_clock::time_point Now) {
+    std::lock_guard<std::mutex> lock(SendMutex);
+    if (!bSuspended || Now < SuspendDeadline) {
+      return false;
+    }
+    bSuspended = false;
+    bResumable = false;
+    bHandshakeComplete = false;
+    return true;
+  }
+
+  // 로그인 완료 (재개 토큰 발급) 여부
+  bool IsResumable() {
+    std::lock_guard<std::mutex> lock(SendMutex);
+    return bResumable;
+  }
+
+  // 재개 1단계: 토큰 확인 후 아직 끊김을 감지하지 못한 이전 연결
+  // (반쯤 열린 TCP)을 강제로 닫음. 이전 수신 스레드는 recv 실패로 빠져나가고
+  // RecvMutex를 놓음. bOutWasLive면 놓친 이벤트가 기록되지 않았으므로
+  // 호출자가 전체 스냅샷을 보내야 함
+  bool BeginTakeOver(const uint8_t *Token, bool &bOutWasLive) {
+    std::lock_guard<std::mutex> lock(SendMutex);
+    if (!bResumable ||
+        sodium_memcmp(ResumeToken, Token, RESUME_TOKEN_SIZE) != 0) {
+      return false;
+    }
+
+    bOutWasLive = !bSuspended;
+    if (!bSuspended && Socket != INVALID_SOCKET) {
+      shutdown(Socket, SD_BOTH);
+    }
+    return true;
+  }
+
+  // 재개 2단계: 새 연결(From)의 소켓/암호화 상태를 이 세션으로 인수
+  // 호출자는 이 세션의 RecvMutex를 잡고 있어야 함 (이전 수신 스레드 종료 후)
+  bool TakeOver(ClientSession &From, const uint8_t *Token,
+                std::map<uint32_t, SnapshotEntry> &OutMissedEnters,
+                std::set<uint32_t> &OutMissedLeaves) {
+    std::scoped_lock lock(SendMutex, From.SendMutex);
+    if (!bResumable ||
+        sodium_memcmp(ResumeToken, Token, RESUME_TOKEN_SIZE) != 0) {
+      return false;
+    }
+
+    // 암호화 상태는 복사가 아니라 이동 (임시 세션 쪽은 지워서 한 곳에만 남김)
+    Socket = From.Socket;
+    Crypto = From.Crypto;
+    From.Crypto = ServerCrypto();
+    bHandshakeComplete = true;
+    bSuspended = false;
+    ++ConnectionSerial;
+
+    OutMissedEnters = std::move(MissedEnters);
+    OutMissedLeaves = std::move(MissedLeaves);
+    MissedEnters.clear();
+    MissedLeaves.clear();
+
+    // 임시 세션은 곧 제거되므로 소켓을 넘겨준 것으로 표시
+    From.Socket = INVALID_SOCKET;
+    From.bHandshakeComplete = false;
+    return true;
+  }
+
   // 복호화된 데이터 수신 (이미 RecvBuffer에 있는 데이터 복호화)
   bool DecryptRecvBuffer(int start, int len) {
-    return Crypto.RecvXor(RecvBuffer + start, len);
+    return Crypto.RecvXor(RecvBuffer.data() + start, len);
+  }
+
+private:
+  // 유예 중 놓친 패킷에서 입장/퇴장/위치만 추림 (SendMutex 보유 상태)
+  void RecordMissed(const char *data, int len) {
+    if (len < (int)sizeof(PacketHeader)) {
+      return;
+    }
+    PacketHeader header;
+    memcpy(&header, data, sizeof(header));
+
+    switch ((PacketType)header.type) {
+    case PacketType::S2C_USER_ENTER: {
+      if (len < (int)sizeof(Pkt_UserEnter))
+        return;
+      Pkt_UserEnter pkt;
+      memcpy(&pkt, data, sizeof(pkt));
+      MissedLeaves.erase(pkt.sessionId);
+      MissedEnters[pkt.sessionId] = {pkt.sessionId, pkt.x, pkt.y, pkt.z,
+                                     pkt.yaw};
+    } break;
+
+    case PacketType::S2C_USER_LEAVE: {
+      if (len < (int)sizeof(Pkt_UserLeave))
+        return;
+      Pkt_UserLeave pkt;
+      memcpy(&pkt, data, sizeof(pkt));
+      // 유예 중 들어왔다 나간 유저는 클라이언트가 모르므로 알릴 필요 없음
+      if (MissedEnters.erase(pkt.sessionId) == 0) {
+        MissedLeaves.insert(pkt.sessionId);
+      }
+    } break;
+
+    case PacketType::S2C_MOVE_BROADCAST: {
+      if (len < (int)sizeof(Pkt_MoveUpdate))
+        return;
+      Pkt_MoveUpdate pkt;
+      memcpy(&pkt, data, sizeof(pkt));
+      auto it = MissedEnters.find(pkt.sessionId);
+      if (it != MissedEnters.end()) {
+        it->second.x = pkt.x;
+        it->second.y = pkt.y;
+        it->second.z = pkt.z;
+        it->second.yaw = pkt.yaw;
+      }
+    } break;
+
+    default:
+      break;
+    }
   }
 };
 } // namespace GsNet
@@ -0,0 +1,279 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+// Slab-allocated Session Table with Generational Handles
+
+#pragma once
+
+#include "Session.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace GsNet {
+// 세션 핸들 = 클라이언트에 내려가는 SessionId
+// [Generation (12 bits)][Index (20 bits)]
+// 슬롯이 재사용되면 Generation이 바뀌므로 끊긴 세션의 핸들은 자동으로 무효
+using SessionHandle = uint32_t;
+
+// 세션 테이블
+// - 세션은 256개 단위 청크(슬랩)에 연속으로 저장, 청크는 한 번 만들면 이동 X
+// - 조회/순회는 락 없이 슬롯별 핀 카운트만 올렸다 내림
+// - 생성/제거만 WriteMutex 사용 (빈 슬롯 목록 관리)
+// - 제거된 슬롯은 마지막 핀이 풀리는 순간 회수되므로 사용 중에 사라지지 않음
+// - 회수된 슬롯은 FIFO로 재사용하고, 세대를 다 쓴 슬롯은 은퇴
+class SessionTable {
+public:
+  static constexpr uint32_t INDEX_BITS = 20;
+  static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+  static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+  static constexpr uint32_t CHUNK_SHIFT = 8;
+  static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_SHIFT;
+  static constexpr uint32_t MAX_CHUNKS = (1u << INDEX_BITS) / CHUNK_SIZE;
+
+  // 회수된 슬롯은 최소 이만큼 쌓인 뒤부터 오래된 순서로 재사용
+  // (같은 슬롯이 빠르게 세대를 소모해 오래된 핸들과 겹치지 않도록)
+  static constexpr size_t MIN_FREE_INDICES = 1024;
+
+private:
+  // 슬롯 상태: [Generation (12 bits)][Alive (1 bit)][Pins (19 bits)]
+  static constexpr uint32_t STATE_GENERATION_SHIFT = INDEX_BITS;
+  static constexpr uint32_t STATE_ALIVE = 1u << (INDEX_BITS - 1);
+  static constexpr uint32_t STATE_PIN_MASK = STATE_ALIVE - 1;
+
+  struct Slot {
+    std::atomic<uint32_t> State{0};
+    std::optional<ClientSession> Session;
+  };
+
+  struct Chunk {
+    std::array<Slot, CHUNK_SIZE> Slots;
+  };
+
+public:
+  // 핀 참조: 살아있는 동안 슬롯이 회수되지 않음 (이동만 가능)
+  class Ref {
+  public:
+    Ref() = default;
+    ~Ref() { Reset(); }
+
+    Ref(Ref &&Other) noexcept : Table(Other.Table), Index(Other.Index) {
+      Other.Table = nullptr;
+    }
+    Ref &operator=(Ref &&Other) noexcept {
+      if (this != &Other) {
+        Reset();
+        Table = Other.Table;
+        Index = Other.Index;
+        Other.Table = nullptr;
+      }
+      return *this;
+    }
+    Ref(const Ref &) = delete;
+    Ref &operator=(const Ref &) = delete;
+
+    explicit operator bool() const { return Table != nullptr; }
+    ClientSession *operator->() const { return &Get(); }
+    ClientSession &operator*() const { return Get(); }
+
+    void Reset() {
+      if (Table) {
+        Table->Unpin(Index);
+        Table = nullptr;
+      }
+    }
+
+  private:
+    friend class SessionTable;
+    Ref(SessionTable *InTable, uint32_t InIndex)
+        : Table(InTable), Index(InIndex) {}
+
+    ClientSession &Get() const { return *Table->SlotAt(Index).Session; }
+
+    SessionTable *Table = nullptr;
+    uint32_t Index = 0;
+  };
+
+  SessionTable() {
+    for (auto &chunk : Chunks) {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~SessionTable() {
+    for (auto &chunk : Chunks) {
+      delete chunk.load(std::memory_order_relaxed);
+    }
+  }
+
+  SessionTable(const SessionTable &) = delete;
+  SessionTable &operator=(const SessionTable &) = delete;
+
+  // 새 세션 생성 (SessionId는 핸들로 채워짐). 가득 차면 빈 Ref 반환
+  Ref Create() {
+    uint32_t index = 0;
+    {
+      std::lock_guard<std::mutex> lock(WriteMutex);
+      if (FreeIndices.size() > MIN_FREE_INDICES ||
+          (!FreeIndices.empty() && NextIndex > INDEX_MASK)) {
+        index = FreeIndices.front();
+        FreeIndices.pop_front();
+      } else {
+        if (NextIndex > INDEX_MASK) {
+          return Ref();
+        }
+        index = NextIndex++;
+        uint32_t chunkIndex = index >> CHUNK_SHIFT;
+        if (chunkIndex >= ChunkCount.load(std::memory_order_relaxed)) {
+          Chunks[chunkIndex].store(new Chunk(), std::memory_order_release);
+          ChunkCount.store(chunkIndex + 1, std::memory_order_release);
+        }
+      }
+    }
+
+    // 회수된 슬롯은 Alive=0, Pins=0 이므로 다른 스레드가 건드리지 않음
+    Slot &slot = SlotAt(index);
+    uint32_t generation =
+        (slot.State.load(std::memory_order_relaxed) >>
+         STATE_GENERATION_SHIFT) +
+        1;
+
+    slot.Session.emplace();
+    slot.Session->SessionId = MakeHandle(index, generation);
+
+    // Alive + 생성자 몫의 핀 1개
+    slot.State.store((generation << STATE_GENERATION_SHIFT) | STATE_ALIVE | 1,
+                     std::memory_order_release);
+    LiveCount.fetch_add(1, std::memory_order_relaxed);
+
+    return Ref(this, index);
+  }
+
+  // 핸들로 세션 조회 (락 없음). 이미 제거됐거나 재사용된 핸들이면 빈 Ref
+  Ref Acquire(SessionHandle Handle) {
+    uint32_t index = Handle & INDEX_MASK;
+    uint32_t generation = Handle >> INDEX_BITS;
+    if (generation == 0 || !HasSlot(index)) {
+      return Ref();
+    }
+    if (!TryPin(SlotAt(index), generation)) {
+      return Ref();
+    }
+    return Ref(this, index);
+  }
+
+  // 세션 제거. 이후 Acquire/ForEach에서 보이지 않고,
+  // 잡고 있는 Ref가 모두 풀리면 슬롯이 회수됨
+  bool Remove(SessionHandle Handle) {
+    uint32_t index = Handle & INDEX_MASK;
+    uint32_t generation = Handle >> INDEX_BITS;
+    if (generation == 0 || !HasSlot(index)) {
+      return false;
+    }
+
+    Slot &slot = SlotAt(index);
+    uint32_t state = slot.State.load(std::memory_order_acquire);
+    while (true) {
+      if (!(state & STATE_ALIVE) ||
+          (state >> STATE_GENERATION_SHIFT) != generation) {
+        return false;
+      }
+      if (slot.State.compare_exchange_weak(state, state & ~STATE_ALIVE,
+                                           std::memory_order_acq_rel)) {
+        break;
+      }
+    }
+
+    LiveCount.fetch_sub(1, std::memory_order_relaxed);
+    if ((state & STATE_PIN_MASK) == 0) {
+      Reclaim(index);
+    }
+    return true;
+  }
+
+  // 살아있는 모든 세션 순회 (락 없음, 연속 메모리 선형 스캔)
+  template <typename Func> void ForEach(Func &&Fn) {
+    uint32_t chunkCount = ChunkCount.load(std::memory_order_acquire);
+    for (uint32_t c = 0; c < chunkCount; ++c) {
+      Chunk *chunk = Chunks[c].load(std::memory_order_acquire);
+      for (uint32_t i = 0; i < CHUNK_SIZE; ++i) {
+        Slot &slot = chunk->Slots[i];
+        if (!TryPin(slot, 0)) {
+          continue;
+        }
+        Fn(*slot.Session);
+        Unpin((c << CHUNK_SHIFT) | i);
+      }
+    }
+  }
+
+  size_t Count() const { return LiveCount.load(std::memory_order_relaxed); }
+
+private:
+  static SessionHandle MakeHandle(uint32_t Index, uint32_t Generation) {
+    return (Generation << INDEX_BITS) | Index;
+  }
+
+  bool HasSlot(uint32_t Index) const {
+    return (Index >> CHUNK_SHIFT) < ChunkCount.load(std::memory_order_acquire);
+  }
+
+  Slot &SlotAt(uint32_t Index) {
+    return Chunks[Index >> CHUNK_SHIFT]
+        .load(std::memory_order_acquire)
+        ->Slots[Index & (CHUNK_SIZE - 1)];
+  }
+
+  // Generation이 0이면 세대 검사 없이 살아있기만 하면 핀
+  static bool TryPin(Slot &InSlot, uint32_t Generation) {
+    uint32_t state = InSlot.State.load(std::memory_order_acquire);
+    while (true) {
+      if (!(state & STATE_ALIVE)) {
+        return false;
+      }
+      if (Generation != 0 && (state >> STATE_GENERATION_SHIFT) != Generation) {
+        return false;
+      }
+      if (InSlot.State.compare_exchange_weak(state, state + 1,
+                                             std::memory_order_acquire)) {
+        return true;
+      }
+    }
+  }
+
+  void Unpin(uint32_t Index) {
+    Slot &slot = SlotAt(Index);
+    uint32_t prev = slot.State.fetch_sub(1, std::memory_order_acq_rel);
+    // 제거된 상태에서 마지막 핀이 풀리면 회수
+    if (!(prev & STATE_ALIVE) && (prev & STATE_PIN_MASK) == 1) {
+      Reclaim(Index);
+    }
+  }
+
+  void Reclaim(uint32_t Index) {
+    Slot &slot = SlotAt(Index);
+    slot.Session.reset();
+
+    // 마지막 세대까지 쓴 슬롯은 은퇴 (세대가 한 바퀴 돌면 옛 핸들이 되살아남)
+    uint32_t generation =
+        slot.State.load(std::memory_order_relaxed) >> STATE_GENERATION_SHIFT;
+    if (generation >= GENERATION_MASK) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(WriteMutex);
+    FreeIndices.push_back(Index);
+  }
+
+private:
+  std::array<std::atomic<Chunk *>, MAX_CHUNKS> Chunks;
+  std::atomic<uint32_t> ChunkCount{0};
+  std::atomic<size_t> LiveCount{0};
+
+  std::mutex WriteMutex;
+  std::deque<uint32_t> FreeIndices; // FIFO: 오래 전에 회수된 슬롯부터 재사용
+  uint32_t NextIndex = 0;
+};
+} // namespace GsNet
@@ -0,0 +1,323 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+// Zone-sharded Simulation Threads
+
+#pragma once
+
+#include "MpscQueue.h"
+#include "SessionTable.h"
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace GsNet {
+// 존 메일박스 메시지
+struct ZoneMessage {
+  enum class EType : uint8_t {
+    None,
+    Enter, // 세션이 이 존 소속이 됨 (로그인 / 경계 이동 핸드오프)
+    Move,  // 세션의 이동 패킷 (경계 검사 후 전체 중계)
+    Relay, // 이 존 소속 세션들에게 그대로 전송 (SessionId는 제외 대상)
+  };
+
+  EType Type = EType::None;
+  SessionHandle SessionId = 0;
+  uint32_t Sequence = 0; // Move: 세션별 이동 순번 (늦게 도착한 이동은 버림)
+  std::shared_ptr<const std::vector<char>> Packet; // 여러 존이 같이 참조
+};
+
+class ZoneManager;
+
+// 존 하나 = 시뮬레이션 스레드 하나
+// 소속 세션 목록은 이 스레드만 만지므로 락이 없고,
+// 다른 스레드와는 메일박스(MPSC 큐)로만 통신함
+class ZoneWorker {
+public:
+  ZoneWorker(ZoneManager &InManager, uint32_t InZoneId)
+      : Manager(InManager), ZoneId(InZoneId) {}
+  ~ZoneWorker() { Stop(); }
+
+  ZoneWorker(const ZoneWorker &) = delete;
+  ZoneWorker &operator=(const ZoneWorker &) = delete;
+
+  void Start() {
+    if (!Thread.joinable()) {
+      bRun = true;
+      Thread = std::thread(&ZoneWorker::Run, this);
+    }
+  }
+
+  void Stop() {
+    if (Thread.joinable()) {
+      bRun = false;
+      WakeCv.notify_one();
+      Thread.join();
+    }
+  }
+
+  // 모든 스레드에서 호출 가능
+  void Post(ZoneMessage &&Message) {
+    Mailbox.Push(std::move(Message));
+    // 락 없이 깨우므로 드물게 신호를 놓칠 수 있지만 대기가 1ms라 허용
+    WakeCv.notify_one();
+  }
+
+  uint32_t GetZoneId() const { return ZoneId; }
+
+private:
+  void Run();
+  void Handle(ZoneMessage &Message);
+  void HandleEnter(SessionHandle SessionId);
+  void HandleMove(ZoneMessage &Message);
+  void SendToMembers(const std::vector<char> &Packet, SessionHandle ExcludeId);
+
+  void AddMember(SessionHandle SessionId) {
+    if (MemberIndex.count(SessionId) == 0) {
+      MemberIndex[SessionId] = Members.size();
+      Members.push_back(SessionId);
+    }
+  }
+
+  void RemoveMemberAt(size_t Index) {
+    MemberIndex.erase(Members[Index]);
+    if (Index + 1 != Members.size()) {
+      Members[Index] = Members.back();
+      MemberIndex[Members[Index]] = Index;
+    }
+    Members.pop_back();
+  }
+
+  void RemoveMember(SessionHandle SessionId) {
+    auto it = MemberIndex.find(SessionId);
+    if (it != MemberIndex.end()) {
+      RemoveMemberAt(it->second);
+    }
+  }
+
+private:
+  ZoneManager &Manager;
+  const uint32_t ZoneId;
+
+  // 이 스레드 전용 (락 없음)
+  std::vector<SessionHandle> Members;
+  std::unordered_map<SessionHandle, size_t> MemberIndex;
+
+  MpscQueue<ZoneMessage> Mailbox;
+  std::mutex WakeMutex;
+  std::condition_variable WakeCv;
+  std::atomic<bool> bRun{false};
+  std::thread Thread;
+};
+
+// 월드를 존으로 나누고 존마다 전용 스레드에 배정
+// - 존 = 평면을 ZONE_CELL_SIZE 격자로 나눈 셀들의 해시 묶음
+//   (셀을 스레드 수만큼 섞어서 배정하므로 유저가 퍼져 있으면 부하가 고르게 분산)
+// - I/O 스레드(ClientHandler)는 수신/복호화만 하고 게임 로직은 메일박스로 넘김
+// - 존 경계를 넘으면 기존 존이 목록에서 빼고 새 존에 Enter를 보내서 핸드오프
+// - 존은 해시로 흩어진 셀 묶음이라 지역이 아님. 이동은 모든 존에 중계
+class ZoneManager {
+public:
+  static constexpr float ZONE_CELL_SIZE = 5000.0f; // 50m (UE 단위)
+
+  ZoneManager(SessionTable &InSessions, uint32_t ZoneCount)
+      : Sessions(InSessions) {
+    if (ZoneCount == 0) {
+      ZoneCount = 1;
+    }
+    Zones.reserve(ZoneCount);
+    for (uint32_t i = 0; i < ZoneCount; ++i) {
+      Zones.push_back(std::make_unique<ZoneWorker>(*this, i));
+    }
+  }
+
+  ~ZoneManager() { Stop(); }
+
+  void Start() {
+    for (auto &zone : Zones) {
+      zone->Start();
+    }
+  }
+
+  void Stop() {
+    for (auto &zone : Zones) {
+      zone->Stop();
+    }
+  }
+
+  uint32_t GetZoneCount() const { return (uint32_t)Zones.size(); }
+  SessionTable &GetSessions() { return Sessions; }
+
+  uint32_t ZoneForPosition(float X, float Y) const {
+    int32_t cellX = (int32_t)std::floor(X / ZONE_CELL_SIZE);
+    int32_t cellY = (int32_t)std::floor(Y / ZONE_CELL_SIZE);
+    uint32_t hash = (uint32_t)cellX * 73856093u ^ (uint32_t)cellY * 19349663u;
+    return hash % (uint32_t)Zones.size();
+  }
+
+  void Post(uint32_t TargetZone, ZoneMessage &&Message) {
+    Zones[TargetZone]->Post(std::move(Message));
+  }
+
+  // 로그인 완료 시 현재 위치의 존에 입장
+  void EnterWorld(ClientSession &Session) {
+    uint32_t zone = ZoneForPosition(Session.LastX, Session.LastY);
+
+    ZoneMessage message;
+    message.Type = ZoneMessage::EType::Enter;
+    message.SessionId = Session.SessionId;
+    Post(zone, std::move(message));
+
+    // Enter를 먼저 넣은 뒤 공개해야 이후 라우팅된 메시지가 Enter 뒤에 쌓임
+    Session.ZoneId.store(zone, std::memory_order_release);
+  }
+
+  // 이동 패킷을 세션의 현재 존으로 전달 (입장 전이면 전체 중계)
+  void PostMove(ClientSession &Session, const char *Data, int Len) {
+    uint32_t zone = Session.ZoneId.load(std::memory_order_acquire);
+    if (zone == ClientSession::INVALID_ZONE) {
+      BroadcastAll(Data, Len, Session.SessionId);
+      return;
+    }
+
+    ZoneMessage message;
+    message.Type = ZoneMessage::EType::Move;
+    message.SessionId = Session.SessionId;
+    message.Sequence = ++Session.MoveSequence;
+    message.Packet = std::make_shared<const std::vector<char>>(Data, Data + Len);
+    Post(zone, std::move(message));
+  }
+
+  // 모든 존 소속 세션에게 전송 (ExcludeId 제외)
+  void BroadcastAll(const char *Data, int Len, SessionHandle ExcludeId) {
+    RelayFrom(ClientSession::INVALID_ZONE,
+              std::make_shared<const std::vector<char>>(Data, Data + Len),
+              ExcludeId);
+  }
+
+  // FromZone을 제외한 모든 존에 중계 (패킷 버퍼는 공유)
+  void RelayFrom(uint32_t FromZone,
+                 const std::shared_ptr<const std::vector<char>> &Packet,
+                 SessionHandle ExcludeId) {
+    for (auto &zone : Zones) {
+      if (zone->GetZoneId() == FromZone) {
+        continue;
+      }
+      ZoneMessage message;
+      message.Type = ZoneMessage::EType::Relay;
+      message.SessionId = ExcludeId;
+      message.Packet = Packet;
+      zone->Post(std::move(message));
+    }
+  }
+
+private:
+  SessionTable &Sessions;
+  std::vector<std::unique_ptr<ZoneWorker>> Zones;
+};
+
+//-------------------------------------------------------------------------
+// ZoneWorker Implementation
+//-------------------------------------------------------------------------
+inline void ZoneWorker::Run() {
+  while (bRun) {
+    bool bProcessed = false;
+    ZoneMessage message;
+    while (Mailbox.Pop(message)) {
+      Handle(message);
+      bProcessed = true;
+    }
+
+    if (!bProcessed) {
+      std::unique_lock<std::mutex> lock(WakeMutex);
+      WakeCv.wait_for(lock, std::chrono::milliseconds(1),
+                      [this] { return !bRun || !Mailbox.IsEmpty(); });
+    }
+  }
+}
+
+inline void ZoneWorker::Handle(ZoneMessage &Message) {
+  switch (Message.Type) {
+  case ZoneMessage::EType::Enter:
+    HandleEnter(Message.SessionId);
+    break;
+  case ZoneMessage::EType::Move:
+    HandleMove(Message);
+    break;
+  case ZoneMessage::EType::Relay:
+    if (Message.Packet) {
+      SendToMembers(*Message.Packet, Message.SessionId);
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+inline void ZoneWorker::HandleEnter(SessionHandle SessionId) {
+  AddMember(SessionId);
+}
+
+inline void ZoneWorker::HandleMove(ZoneMessage &Message) {
+  SessionTable::Ref session = Manager.GetSessions().Acquire(Message.SessionId);
+  if (!session || !Message.Packet) {
+    return;
+  }
+
+  // 핸드오프 직후 예전 존으로 들어온 메시지는 현재 존으로 넘김
+  if (MemberIndex.count(Message.SessionId) == 0) {
+    uint32_t current = session->ZoneId.load(std::memory_order_acquire);
+    if (current != ZoneId && current != ClientSession::INVALID_ZONE) {
+      Manager.Post(current, std::move(Message));
+    }
+    return;
+  }
+
+  // 핸드오프 전후로 순서가 뒤바뀐 이동은 버림 (더 최신 이동이 이미 중계됨)
+  uint32_t lastSequence =
+      session->LastRelayedMove.load(std::memory_order_acquire);
+  do {
+    if (Message.Sequence <= lastSequence) {
+      return;
+    }
+  } while (!session->LastRelayedMove.compare_exchange_weak(
+      lastSequence, Message.Sequence, std::memory_order_acq_rel));
+
+  // 존 경계 검사 → 핸드오프
+  uint32_t target = Manager.ZoneForPosition(session->LastX, session->LastY);
+  if (target != ZoneId) {
+    RemoveMember(Message.SessionId);
+
+    ZoneMessage enter;
+    enter.Type = ZoneMessage::EType::Enter;
+    enter.SessionId = Message.SessionId;
+    Manager.Post(target, std::move(enter));
+    session->ZoneId.store(target, std::memory_order_release);
+  }
+
+  // 내 존은 직접, 나머지 존은 메일박스로 중계
+  SendToMembers(*Message.Packet, Message.SessionId);
+  Manager.RelayFrom(ZoneId, Message.Packet, Message.SessionId);
+}
+
+inline void ZoneWorker::SendToMembers(const std::vector<char> &Packet,
+                                      SessionHandle ExcludeId) {
+  size_t i = 0;
+  while (i < Members.size()) {
+    SessionTable::Ref member = Manager.GetSessions().Acquire(Members[i]);
+    if (!member) {
+      // 접속 종료된 세션은 여기서 정리 (별도 Leave 메시지 불필요)
+      RemoveMemberAt(i);
+      continue;
+    }
+
+    if (Members[i] != ExcludeId && member->bHandshakeComplete) {
+      member->SendEncrypted(Packet.data(), (int)Packet.size());
+    }
+    ++i;
+  }
+}
+} // namespace GsNet
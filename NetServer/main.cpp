@@ -1,20 +1,35 @@
 #include "Protocol.h"
 #include "Session.h"
+#include "SessionTable.h"
+#include "Zone.h"
 #include <WinSock2.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
-#include <map>
-#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #pragma comment(lib, "ws2_32.lib")
 
 void ClientHandler(SOCKET clientSock, uint32_t sessionId);
 void BroadcastPacket(char *data, int len, uint32_t excludeId);
-
-std::mutex g_sessionMutex;
-std::map<uint32_t, std::shared_ptr<GsNet::ClientSession>> g_sessions;
-uint32_t g_idCounter = 1;
+bool SendWorldSnapshot(GsNet::ClientSession &session);
+bool SendSnapshotEntries(GsNet::ClientSession &session,
+                         const std::vector<SnapshotEntry> &entries);
+std::vector<SnapshotEntry> CollectWorldSnapshot(uint32_t excludeId);
+bool ResumeSession(GsNet::SessionTable::Ref &session, uint32_t &sessionId,
+                   uint32_t &connectionSerial,
+                   std::unique_lock<std::timed_mutex> &recvLock,
+                   const Pkt_ResumeReq &req);
+void ExpireSuspendedSessions();
+
+// 세션 테이블 (SessionId = 세대 포함 핸들)
+// 조회/순회는 락 없이, 생성/제거만 내부 락 사용
+GsNet::SessionTable g_sessions;
+
+// 존별 시뮬레이션 스레드 (코어 수만큼)
+GsNet::ZoneManager g_zones(g_sessions, std::thread::hardware_concurrency());
 
 int main() {
   if (sodium_init() < 0) {
@@ -57,8 +72,14 @@ int main() {
     return 1;
   }
 
-  std::cout << "[Server] Listening on port 9000... (Encryption Enabled)"
-            << std::endl;
+  g_zones.Start();
+
+  // 유예 시간이 지난 세션 정리
+  std::thread reaper(ExpireSuspendedSessions);
+  reaper.detach();
+
+  std::cout << "[Server] Listening on port 9000... (Encryption Enabled, "
+            << g_zones.GetZoneCount() << " zones)" << std::endl;
 
   while (true) {
     SOCKADDR_IN clientAddr;
@@ -73,23 +94,22 @@ int main() {
     BOOL opt = TRUE;
     setsockopt(clientSock, IPPROTO_TCP, TCP_NODELAY, (char *)&opt, sizeof(opt));
 
-    auto session = std::make_shared<GsNet::ClientSession>();
+    GsNet::SessionTable::Ref session = g_sessions.Create();
+    if (!session) {
+      std::cerr << "[Server] Session table full." << std::endl;
+      closesocket(clientSock);
+      continue;
+    }
     session->Socket = clientSock;
 
+    uint32_t newSessionId = session->SessionId;
     if (!session->Initialize()) {
       std::cerr << "[Server] Session initialization failed." << std::endl;
+      g_sessions.Remove(newSessionId);
       closesocket(clientSock);
       continue;
     }
 
-    uint32_t newSessionId = 0;
-    {
-      std::lock_guard<std::mutex> lock(g_sessionMutex);
-      newSessionId = g_idCounter++;
-      session->SessionId = newSessionId;
-      g_sessions[newSessionId] = session;
-    }
-
     std::cout << "[Server] Client Connected. SessionID: " << newSessionId
               << std::endl;
 
@@ -97,23 +117,25 @@ int main() {
     t.detach();
   }
 
+  g_zones.Stop();
   closesocket(listenSock);
   WSACleanup();
   return 0;
 }
 
 void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
-  std::shared_ptr<GsNet::ClientSession> session;
-  {
-    std::lock_guard<std::mutex> lock(g_sessionMutex);
-    auto it = g_sessions.find(sessionId);
-    if (it == g_sessions.end()) {
-      closesocket(clientSock);
-      return;
-    }
-    session = it->second;
+  GsNet::SessionTable::Ref session = g_sessions.Acquire(sessionId);
+  if (!session) {
+    closesocket(clientSock);
+    return;
   }
 
+  // 세션 재개로 다른 연결이 인수하면 값이 바뀜 (종료 처리 시 비교)
+  uint32_t connectionSerial = session->ConnectionSerial;
+
+  // 이 스레드가 끝날 때까지 세션의 수신(RX 복호화)을 독점
+  std::unique_lock<std::timed_mutex> recvLock(session->RecvMutex);
+
   // 1. Handshake
   if (!session->SendHandshake()) {
     std::cerr << "[Server] Failed to send handshake. SessionID: " << sessionId
@@ -171,10 +193,10 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
     // decrypt ONLY the copy to peek at the size, then receive the rest, and
     // finally decrypt the ENTIRE original packet.
 
-    uint8_t packetBuffer[4096];
+    const int headerSize = sizeof(PacketHeader); // 4 bytes
+    uint8_t *packetBuffer = session->GrowRecvBuffer(headerSize);
 
     int headerRecv = 0;
-    const int headerSize = sizeof(PacketHeader); // 4 bytes
 
     // 1. Receive Header (4 bytes)
     while (headerRecv < headerSize) {
@@ -192,16 +214,18 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
       goto cleanup;
     }
 
-    PacketHeader *header = (PacketHeader *)packetBuffer;
+    PacketHeader header = *(PacketHeader *)packetBuffer;
 
-    if (header->size < headerSize || header->size > 4096) {
-      std::cerr << "[Server] Invalid packet size: " << header->size
+    if (header.size < headerSize ||
+        header.size > GsNet::ClientSession::MAX_PACKET_SIZE) {
+      std::cerr << "[Server] Invalid packet size: " << header.size
                 << " SessionID: " << sessionId << std::endl;
       goto cleanup;
     }
 
-    // 3. Receive Body
-    int bodySize = header->size - headerSize;
+    // 3. Receive Body (버퍼가 커질 수 있으므로 포인터 갱신)
+    packetBuffer = session->GrowRecvBuffer(header.size);
+    int bodySize = header.size - headerSize;
     int bodyRecv = 0;
 
     if (bodySize > 0) {
@@ -223,7 +247,7 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
     }
 
     // Handle packet
-    PacketType type = (PacketType)header->type;
+    PacketType type = (PacketType)header.type;
 
     switch (type) {
     case PacketType::C2S_LOGIN_REQ: {
@@ -236,6 +260,7 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
       res.type = (uint16_t)PacketType::S2C_LOGIN_RES;
       res.mySessionId = sessionId;
       res.success = true;
+      session->EnableResume(res.resumeToken);
 
       if (!session->SendEncrypted((char *)&res, res.size)) {
         std::cerr << "[Server] Failed to send login response. SessionID: "
@@ -247,10 +272,15 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
                 << std::endl;
 
       // [추가] 유저 입장 동기화
+      // 기존 유저 목록은 스냅샷 한 번으로, 내 입장은 기존 유저당 한 번씩 알림
+      // (전역 락을 잡지 않으므로 동시 로그인이 서로 막지 않음)
       {
-        std::lock_guard<std::mutex> lock(g_sessionMutex);
+        if (!SendWorldSnapshot(*session)) {
+          std::cerr << "[Server] Failed to send world snapshot. SessionID: "
+                    << sessionId << std::endl;
+          goto cleanup;
+        }
 
-        // 1. 새 유저 정보 패킷 생성
         Pkt_UserEnter newInfo;
         newInfo.size = sizeof(Pkt_UserEnter);
         newInfo.type = (uint16_t)PacketType::S2C_USER_ENTER;
@@ -260,27 +290,37 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
         newInfo.z = 0;
         newInfo.yaw = 0;
 
-        // 2. 루프: 기존 유저 정보 <-> 새 유저 정보 교환
-        for (auto &pair : g_sessions) {
-          if (pair.first == sessionId)
-            continue; // 나 자신 제외
-          auto &otherSession = pair.second;
-          if (otherSession && otherSession->bHandshakeComplete) {
-            // A. 기존 유저들에게 "새 유저(나) 들어왔어" 알림
-            otherSession->SendEncrypted((char *)&newInfo, newInfo.size);
-
-            // B. 새 유저(나)에게 "기존 유저(너) 정보 줘" 알림
-            Pkt_UserEnter existingInfo;
-            existingInfo.size = sizeof(Pkt_UserEnter);
-            existingInfo.type = (uint16_t)PacketType::S2C_USER_ENTER;
-            existingInfo.sessionId = otherSession->SessionId;
-            existingInfo.x = otherSession->LastX;
-            existingInfo.y = otherSession->LastY;
-            existingInfo.z = otherSession->LastZ;
-            existingInfo.yaw = otherSession->LastYaw;
-
-            session->SendEncrypted((char *)&existingInfo, existingInfo.size);
-          }
+        BroadcastPacket((char *)&newInfo, newInfo.size, sessionId);
+
+        // 이후 이동 패킷은 소속 존 스레드가 처리
+        g_zones.EnterWorld(*session);
+      }
+    } break;
+
+    case PacketType::C2S_RESUME_REQ: {
+      if (header.size < sizeof(Pkt_ResumeReq)) {
+        goto cleanup;
+      }
+      Pkt_ResumeReq *reqPkt = (Pkt_ResumeReq *)packetBuffer;
+      uint32_t tempSessionId = sessionId;
+
+      if (ResumeSession(session, sessionId, connectionSerial, recvLock,
+                        *reqPkt)) {
+        std::cout << "[Server] Session resumed. SessionID: " << sessionId
+                  << " (Connection: " << tempSessionId << ")" << std::endl;
+      } else {
+        std::cout << "[Server] Session resume rejected. SessionID: "
+                  << reqPkt->sessionId << std::endl;
+
+        Pkt_ResumeRes res;
+        res.size = sizeof(Pkt_ResumeRes);
+        res.type = (uint16_t)PacketType::S2C_RESUME_RES;
+        res.sessionId = reqPkt->sessionId;
+        res.success = false;
+        res.fullSync = false;
+        res.userCount = 0;
+        if (!session->SendEncrypted((char *)&res, res.size)) {
+          goto cleanup;
         }
       }
     } break;
@@ -296,7 +336,8 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
       session->LastZ = pkt->z;
       session->LastYaw = pkt->yaw;
 
-      BroadcastPacket((char *)packetBuffer, pkt->size, sessionId);
+      // 경계 검사/중계는 존 스레드에서 처리
+      g_zones.PostMove(*session, (char *)packetBuffer, pkt->size);
     } break;
 
     case PacketType::C2S_ATTACK: {
@@ -307,37 +348,192 @@ void ClientHandler(SOCKET clientSock, uint32_t sessionId) {
     } break;
 
     default:
-      std::cerr << "[Server] Unknown packet type: " << (int)header->type
+      std::cerr << "[Server] Unknown packet type: " << (int)header.type
                 << " SessionID: " << sessionId << std::endl;
       break;
     }
   }
 
-  // [추가] 연결 종료 시 퇴장 알림 전송
-  Pkt_UserLeave leavePkt;
-  leavePkt.size = sizeof(Pkt_UserLeave);
-  leavePkt.type = (uint16_t)PacketType::S2C_USER_LEAVE;
-  leavePkt.sessionId = sessionId;
-  BroadcastPacket((char *)&leavePkt, leavePkt.size, sessionId);
-
-cleanup: {
-  std::lock_guard<std::mutex> lock(g_sessionMutex);
-  g_sessions.erase(sessionId);
-}
+cleanup:
+  // 로그인한 세션은 바로 지우지 않고 유예 (퇴장 알림은 만료 시 전송)
+  // 다른 스레드가 잡고 있는 참조가 모두 풀린 뒤 슬롯이 회수됨
+  if (session->CloseConnection(connectionSerial)) {
+    g_sessions.Remove(sessionId);
+  }
   closesocket(clientSock);
   std::cout << "[Server] Client Disconnected. SessionID: " << sessionId
             << std::endl;
 }
 
-void BroadcastPacket(char *data, int len, uint32_t excludeId) {
-  std::lock_guard<std::mutex> lock(g_sessionMutex);
-  for (auto &pair : g_sessions) {
-    if (pair.first == excludeId)
-      continue;
+// 새 연결(session)을 끊기기 전 세션(req.sessionId)에 붙임
+// 성공하면 session/sessionId/connectionSerial/recvLock이 기존 세션 것으로
+// 바뀌고, 유예 중 놓친 입장/퇴장만 델타로 전송됨 (전체 월드 재전송 없음)
+// 서버가 끊김을 감지하기 전(반쯤 열린 TCP)이면 델타가 없으므로 전체 스냅샷
+bool ResumeSession(GsNet::SessionTable::Ref &session, uint32_t &sessionId,
+                   uint32_t &connectionSerial,
+                   std::unique_lock<std::timed_mutex> &recvLock,
+                   const Pkt_ResumeReq &req) {
+  // 이미 로그인한 연결은 재개 불가 (다른 유저에게 스폰된 액터가 남음)
+  if (session->IsResumable()) {
+    return false;
+  }
+
+  GsNet::SessionTable::Ref resumed = g_sessions.Acquire(req.sessionId);
+  if (!resumed || req.sessionId == sessionId) {
+    return false;
+  }
+
+  bool bWasLive = false;
+  if (!resumed->BeginTakeOver(req.resumeToken, bWasLive)) {
+    return false;
+  }
 
-    auto &session = pair.second;
-    if (session && session->bHandshakeComplete) {
-      session->SendEncrypted(data, len);
+  // 이전 연결의 수신 스레드가 빠져나갈 때까지 대기 (RX 상태 경합 방지)
+  std::unique_lock<std::timed_mutex> resumedRecvLock(resumed->RecvMutex,
+                                                     std::defer_lock);
+  if (!resumedRecvLock.try_lock_for(std::chrono::seconds(
+          GsNet::ClientSession::RESUME_GRACE_SECONDS))) {
+    return false;
+  }
+
+  std::map<uint32_t, SnapshotEntry> missedEnters;
+  std::set<uint32_t> missedLeaves;
+  if (!resumed->TakeOver(*session, req.resumeToken, missedEnters,
+                         missedLeaves)) {
+    return false;
+  }
+
+  // 임시 세션 제거 후 기존 세션으로 교체 (로그인 전이므로 퇴장 알림 불필요)
+  g_sessions.Remove(sessionId);
+  recvLock = std::move(resumedRecvLock);
+  session = std::move(resumed);
+  sessionId = req.sessionId;
+  connectionSerial = session->ConnectionSerial;
+
+  std::vector<SnapshotEntry> entries;
+  if (bWasLive) {
+    entries = CollectWorldSnapshot(sessionId);
+    missedLeaves.clear();
+  } else {
+    entries.reserve(missedEnters.size());
+    for (auto &pair : missedEnters) {
+      entries.push_back(pair.second);
     }
   }
+
+  Pkt_ResumeRes res;
+  res.size = sizeof(Pkt_ResumeRes);
+  res.type = (uint16_t)PacketType::S2C_RESUME_RES;
+  res.sessionId = sessionId;
+  res.success = true;
+  res.fullSync = bWasLive;
+  res.userCount = (uint32_t)entries.size();
+  if (!session->SendEncrypted((char *)&res, res.size)) {
+    return true; // 인수는 끝났으므로 수신 루프에서 끊김 처리
+  }
+
+  if (bWasLive || !entries.empty()) {
+    SendSnapshotEntries(*session, entries);
+  }
+
+  for (uint32_t leftId : missedLeaves) {
+    Pkt_UserLeave leavePkt;
+    leavePkt.size = sizeof(Pkt_UserLeave);
+    leavePkt.type = (uint16_t)PacketType::S2C_USER_LEAVE;
+    leavePkt.sessionId = leftId;
+    session->SendEncrypted((char *)&leavePkt, leavePkt.size);
+  }
+
+  return true;
+}
+
+// 유예 시간이 지난 세션을 제거하고 퇴장 알림 전송
+void ExpireSuspendedSessions() {
+  while (true) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    auto now = std::chrono::steady_clock::now();
+    std::vector<uint32_t> expired;
+    g_sessions.ForEach([&](GsNet::ClientSession &session) {
+      if (session.TryExpire(now)) {
+        expired.push_back(session.SessionId);
+      }
+    });
+
+    for (uint32_t expiredId : expired) {
+      g_sessions.Remove(expiredId);
+
+      Pkt_UserLeave leavePkt;
+      leavePkt.size = sizeof(Pkt_UserLeave);
+      leavePkt.type = (uint16_t)PacketType::S2C_USER_LEAVE;
+      leavePkt.sessionId = expiredId;
+      BroadcastPacket((char *)&leavePkt, leavePkt.size, expiredId);
+
+      std::cout << "[Server] Session expired. SessionID: " << expiredId
+                << std::endl;
+    }
+  }
+}
+
+// 모든 존에 중계 (각 존 스레드가 소속 세션에게 암호화/전송)
+void BroadcastPacket(char *data, int len, uint32_t excludeId) {
+  g_zones.BroadcastAll(data, len, excludeId);
+}
+
+// 기존 유저 전체를 Pkt_WorldSnapshot 프레임에 담아 전송
+// 한 프레임(최대 65535 바이트)에 약 3000명이 들어가므로 보통 1회 전송
+bool SendWorldSnapshot(GsNet::ClientSession &session) {
+  // 아무도 없어도 빈 스냅샷 1회 전송 (클라이언트가 동기화 완료를 알 수 있음)
+  return SendSnapshotEntries(session, CollectWorldSnapshot(session.SessionId));
+}
+
+// excludeId를 제외한 접속 중인 유저의 마지막 위치
+std::vector<SnapshotEntry> CollectWorldSnapshot(uint32_t excludeId) {
+  std::vector<SnapshotEntry> entries;
+  entries.reserve(g_sessions.Count());
+  g_sessions.ForEach([&](GsNet::ClientSession &other) {
+    if (other.SessionId == excludeId || !other.bHandshakeComplete)
+      return;
+
+    SnapshotEntry entry;
+    entry.sessionId = other.SessionId;
+    entry.x = other.LastX;
+    entry.y = other.LastY;
+    entry.z = other.LastZ;
+    entry.yaw = other.LastYaw;
+    entries.push_back(entry);
+  });
+  return entries;
+}
+
+// 엔트리를 Pkt_WorldSnapshot 프레임 단위로 나눠 전송
+bool SendSnapshotEntries(GsNet::ClientSession &session,
+                         const std::vector<SnapshotEntry> &entries) {
+  constexpr size_t maxEntries =
+      (UINT16_MAX - sizeof(Pkt_WorldSnapshot)) / sizeof(SnapshotEntry);
+
+  std::vector<char> frame;
+  size_t offset = 0;
+  do {
+    size_t count = (std::min)(maxEntries, entries.size() - offset);
+    size_t frameSize =
+        sizeof(Pkt_WorldSnapshot) + count * sizeof(SnapshotEntry);
+    frame.resize(frameSize);
+
+    Pkt_WorldSnapshot *pkt = (Pkt_WorldSnapshot *)frame.data();
+    pkt->size = (uint16_t)frameSize;
+    pkt->type = (uint16_t)PacketType::S2C_WORLD_SNAPSHOT;
+    pkt->count = (uint16_t)count;
+    if (count > 0) {
+      memcpy(frame.data() + sizeof(Pkt_WorldSnapshot), &entries[offset],
+             count * sizeof(SnapshotEntry));
+    }
+
+    if (!session.SendEncrypted(frame.data(), (int)frameSize))
+      return false;
+
+    offset += count;
+  } while (offset < entries.size());
+
+  return true;
 }
@@ -1,6 +1,7 @@
 #include "CoreBSPGenerator.h"
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 namespace DungeonCore {
 
@@ -12,111 +13,136 @@ void CoreBSPGenerator::Generate(CoreDungeonGrid &Grid, IRandom &Random,
     return;
   }
 
+  // 이전 생성의 용량은 유지한 채 초기화
+  Nodes.clear();
+  NodeStack.clear();
+  Leaves.clear();
+
+  // 노드 수 상한 (리프 하나는 최소 MinNodeSize x MinNodeSize)
+  const int32_t LeafSize = std::max(MinNodeSize, 1);
+  const size_t MaxLeaves = static_cast<size_t>(Grid.Width / LeafSize) *
+                           (Grid.Height / LeafSize);
+  Nodes.reserve(MaxLeaves * 2);
+  Leaves.reserve(MaxLeaves);
+
   // 루트 노드 생성
-  auto RootNode = std::make_shared<CoreBSPNode>(0, 0, Grid.Width, Grid.Height);
+  Nodes.emplace_back(0, 0, Grid.Width, Grid.Height);
 
-  // 재귀적 분할
-  SplitNode(RootNode, Random, Logger);
+  // 분할
+  SplitNodes(Random);
 
   // 방 생성
-  CreateRooms(RootNode, Grid, Random);
+  CreateRooms(Grid, Random);
 
   // 방 연결 (복도 생성)
-  ConnectRooms(RootNode, Grid, Random);
+  ConnectRooms(Grid);
 }
 
-void CoreBSPGenerator::SplitNode(std::shared_ptr<CoreBSPNode> Node,
-                                 IRandom &Random, ILogger *Logger) {
-  if (!Node)
-    return;
+void CoreBSPGenerator::SplitNodes(IRandom &Random) {
+  // 명시적 스택으로 전위 순회 (재귀 버전과 같은 난수 소비 순서)
+  NodeStack.push_back(0);
 
-  // 더 이상 분할할 수 없으면 중단
-  if (Node->Width < MinNodeSize * 2 && Node->Height < MinNodeSize * 2)
-    return;
+  while (!NodeStack.empty()) {
+    const int32_t NodeIndex = NodeStack.back();
+    NodeStack.pop_back();
 
-  bool bSplitH = Random.GetFraction() > 0.5f;
-  const float AspectRatioThreshold = 1.25f;
+    // emplace_back 이후에는 참조가 무효화될 수 있으므로 값으로 복사
+    const CoreBSPNode Node = Nodes[NodeIndex];
 
-  // 비율에 따라 분할 방향 결정
-  if (Node->Width > Node->Height &&
-      (float)Node->Width / Node->Height >= AspectRatioThreshold) {
-    bSplitH = false; // 수직 분할
-  } else if (Node->Height > Node->Width &&
-             (float)Node->Height / Node->Width >= AspectRatioThreshold) {
-    bSplitH = true; // 수평 분할
-  }
+    // 더 이상 분할할 수 없으면 중단
+    if (Node.Width < MinNodeSize * 2 && Node.Height < MinNodeSize * 2) {
+      Leaves.push_back(NodeIndex);
+      continue;
+    }
 
-  int32_t Max = (bSplitH ? Node->Height : Node->Width) - MinNodeSize;
-  if (Max <= MinNodeSize)
-    return;
+    bool bSplitH = Random.GetFraction() > 0.5f;
+    const float AspectRatioThreshold = 1.25f;
 
-  int32_t SplitPos = Random.RandRange(MinNodeSize, Max);
+    // 비율에 따라 분할 방향 결정
+    if (Node.Width > Node.Height &&
+        (float)Node.Width / Node.Height >= AspectRatioThreshold) {
+      bSplitH = false; // 수직 분할
+    } else if (Node.Height > Node.Width &&
+               (float)Node.Height / Node.Width >= AspectRatioThreshold) {
+      bSplitH = true; // 수평 분할
+    }
 
-  if (bSplitH) {
-    Node->Left =
-        std::make_shared<CoreBSPNode>(Node->X, Node->Y, Node->Width, SplitPos);
-    Node->Right = std::make_shared<CoreBSPNode>(
-        Node->X, Node->Y + SplitPos, Node->Width, Node->Height - SplitPos);
-  } else {
-    Node->Left =
-        std::make_shared<CoreBSPNode>(Node->X, Node->Y, SplitPos, Node->Height);
-    Node->Right = std::make_shared<CoreBSPNode>(
-        Node->X + SplitPos, Node->Y, Node->Width - SplitPos, Node->Height);
-  }
-  Node->bIsLeaf = false;
+    int32_t Max = (bSplitH ? Node.Height : Node.Width) - MinNodeSize;
+    if (Max <= MinNodeSize) {
+      Leaves.push_back(NodeIndex);
+      continue;
+    }
+
+    int32_t SplitPos = Random.RandRange(MinNodeSize, Max);
+
+    const int32_t LeftIndex = static_cast<int32_t>(Nodes.size());
+    const int32_t RightIndex = LeftIndex + 1;
+    if (bSplitH) {
+      Nodes.emplace_back(Node.X, Node.Y, Node.Width, SplitPos);
+      Nodes.emplace_back(Node.X, Node.Y + SplitPos, Node.Width,
+                         Node.Height - SplitPos);
+    } else {
+      Nodes.emplace_back(Node.X, Node.Y, SplitPos, Node.Height);
+      Nodes.emplace_back(Node.X + SplitPos, Node.Y, Node.Width - SplitPos,
+                         Node.Height);
+    }
 
-  SplitNode(Node->Left, Random, Logger);
-  SplitNode(Node->Right, Random, Logger);
+    CoreBSPNode &Parent = Nodes[NodeIndex];
+    Parent.Left = LeftIndex;
+    Parent.Right = RightIndex;
+    Parent.bIsLeaf = false;
+
+    // 왼쪽 서브트리를 먼저 처리
+    NodeStack.push_back(RightIndex);
+    NodeStack.push_back(LeftIndex);
+  }
 }
 
-void CoreBSPGenerator::CreateRooms(std::shared_ptr<CoreBSPNode> Node,
-                                   CoreDungeonGrid &Grid, IRandom &Random) {
-  if (!Node)
-    return;
+void CoreBSPGenerator::CreateRooms(CoreDungeonGrid &Grid, IRandom &Random) {
+  for (const int32_t LeafIndex : Leaves) {
+    CoreBSPNode &Node = Nodes[LeafIndex];
 
-  if (Node->bIsLeaf) {
     // 리프 노드 내부에 랜덤한 크기의 방 생성
-    int32_t RoomWidth = Random.RandRange(MinRoomSize, Node->Width - 2);
-    int32_t RoomHeight = Random.RandRange(MinRoomSize, Node->Height - 2);
-    int32_t RoomX = Random.RandRange(1, Node->Width - RoomWidth - 1);
-    int32_t RoomY = Random.RandRange(1, Node->Height - RoomHeight - 1);
-
-    Node->RoomX = Node->X + RoomX;
-    Node->RoomY = Node->Y + RoomY;
-    Node->RoomWidth = RoomWidth;
-    Node->RoomHeight = RoomHeight;
-
-    for (int32_t Y = Node->RoomY; Y < Node->RoomY + RoomHeight; Y++) {
-      for (int32_t X = Node->RoomX; X < Node->RoomX + RoomWidth; X++) {
+    int32_t RoomWidth = Random.RandRange(MinRoomSize, Node.Width - 2);
+    int32_t RoomHeight = Random.RandRange(MinRoomSize, Node.Height - 2);
+    int32_t RoomX = Random.RandRange(1, Node.Width - RoomWidth - 1);
+    int32_t RoomY = Random.RandRange(1, Node.Height - RoomHeight - 1);
+
+    Node.RoomX = Node.X + RoomX;
+    Node.RoomY = Node.Y + RoomY;
+    Node.RoomWidth = RoomWidth;
+    Node.RoomHeight = RoomHeight;
+
+    for (int32_t Y = Node.RoomY; Y < Node.RoomY + RoomHeight; Y++) {
+      for (int32_t X = Node.RoomX; X < Node.RoomX + RoomWidth; X++) {
         if (Grid.IsValid(X, Y)) {
-          Grid.GetTile(X, Y).Type = ETileType::Floor;
+          Grid.SetType(X, Y, ETileType::Floor);
         }
       }
     }
-  } else {
-    CreateRooms(Node->Left, Grid, Random);
-    CreateRooms(Node->Right, Grid, Random);
   }
 }
 
-void CoreBSPGenerator::ConnectRooms(std::shared_ptr<CoreBSPNode> Node,
-                                    CoreDungeonGrid &Grid, IRandom &Random) {
-  if (!Node || Node->bIsLeaf)
-    return;
-
-  ConnectRooms(Node->Left, Grid, Random);
-  ConnectRooms(Node->Right, Grid, Random);
+void CoreBSPGenerator::ConnectRooms(CoreDungeonGrid &Grid) {
+  // 자식 인덱스는 항상 부모보다 크므로 역순 순회 = 자식 먼저 연결
+  for (size_t i = Nodes.size(); i-- > 0;) {
+    const CoreBSPNode &Node = Nodes[i];
+    if (Node.bIsLeaf)
+      continue;
 
-  // 간단한 연결 로직 (중심점 연결)
-  // 실제 구현에서는 A* 알고리즘 등을 사용하여 더 자연스러운 경로를 만들 수
-  // 있습니다.
+    // 간단한 연결 로직 (중심점 연결)
+    // 실제 구현에서는 A* 알고리즘 등을 사용하여 더 자연스러운 경로를 만들 수
+    // 있습니다.
+    const CoreBSPNode &Left = Nodes[Node.Left];
+    const CoreBSPNode &Right = Nodes[Node.Right];
 
-  int32_t X1 = Node->Left->X + Node->Left->Width / 2;
-  int32_t Y1 = Node->Left->Y + Node->Left->Height / 2;
-  int32_t X2 = Node->Right->X + Node->Right->Width / 2;
-  int32_t Y2 = Node->Right->Y + Node->Right->Height / 2;
+    int32_t X1 = Left.X + Left.Width / 2;
+    int32_t Y1 = Left.Y + Left.Height / 2;
+    int32_t X2 = Right.X + Right.Width / 2;
+    int32_t Y2 = Right.Y + Right.Height / 2;
 
-  CreateCorridor(Grid, X1, Y1, X2, Y2);
+    CreateCorridor(Grid, X1, Y1, X2, Y2);
+  }
 }
 
 void CoreBSPGenerator::CreateCorridor(CoreDungeonGrid &Grid, int32_t X1,
@@ -132,7 +158,7 @@ void CoreBSPGenerator::CreateCorridor(CoreDungeonGrid &Grid, int32_t X1,
     // 복도 폭만큼 타일 생성
     for (int32_t Offset = -HalfWidth; Offset < CorridorWidth - HalfWidth; Offset++) {
       if (Grid.IsValid(X, Y + Offset)) {
-        Grid.GetTile(X, Y + Offset).Type = ETileType::Corridor;
+        Grid.SetType(X, Y + Offset, ETileType::Corridor);
       }
     }
     X += (X2 > X) ? 1 : -1;
@@ -143,7 +169,7 @@ void CoreBSPGenerator::CreateCorridor(CoreDungeonGrid &Grid, int32_t X1,
     // 복도 폭만큼 타일 생성
     for (int32_t Offset = -HalfWidth; Offset < CorridorWidth - HalfWidth; Offset++) {
       if (Grid.IsValid(X + Offset, Y)) {
-        Grid.GetTile(X + Offset, Y).Type = ETileType::Corridor;
+        Grid.SetType(X + Offset, Y, ETileType::Corridor);
       }
     }
     Y += (Y2 > Y) ? 1 : -1;
@@ -153,18 +179,29 @@ void CoreBSPGenerator::CreateCorridor(CoreDungeonGrid &Grid, int32_t X1,
 // 다층 던전 구현
 CoreMultiFloorDungeon
 CoreBSPGenerator::GenerateMultiFloor(const CoreMultiFloorConfig &Config,
-                                     IRandom &Random, ILogger *Logger) {
+                                     IRandom &Random, ILogger *Logger,
+                                     IExecutor *Executor) {
   CoreMultiFloorDungeon MultiFloor;
   MultiFloor.NumFloors = Config.NumFloors;
   MultiFloor.Floors.resize(Config.NumFloors);
 
-  // 순차적 생성 (Core에서는 단순성을 위해 순차 처리, 병렬 처리는 호출자에게
-  // 위임 가능)
-  for (int32_t i = 0; i < Config.NumFloors; i++) {
-    CoreDungeonGrid Grid(Config.Width, Config.Height, ETileType::Wall);
+  // 층별 생성 (층끼리 공유하는 상태가 없으므로 병렬 실행 가능)
+  const int32_t BaseSeed = Random.GetInitialSeed();
+  auto GenerateFloor = [&](int32_t FloorIndex) {
+    std::unique_ptr<IRandom> FloorRandom =
+        Random.CreateChild(DeriveFloorSeed(BaseSeed, FloorIndex));
+    CoreDungeonGrid &Grid = MultiFloor.Floors[FloorIndex];
+    Grid.Init(Config.Width, Config.Height, ETileType::Wall);
     CoreBSPGenerator Generator; // 기본 설정 사용 또는 Config 전달
-    Generator.Generate(Grid, Random, Logger);
-    MultiFloor.Floors[i] = Grid;
+    Generator.Generate(Grid, *FloorRandom, Logger);
+  };
+
+  if (Executor) {
+    Executor->ParallelFor(Config.NumFloors, GenerateFloor);
+  } else {
+    for (int32_t i = 0; i < Config.NumFloors; i++) {
+      GenerateFloor(i);
+    }
   }
 
   // 수직 정렬 강제
@@ -185,13 +222,14 @@ void CoreBSPGenerator::EnforceVerticalAlignment(
     auto &CurrentFloor = MultiFloor.Floors[Floor];
     auto &BelowFloor = MultiFloor.Floors[Floor - 1];
 
-    for (int32_t Y = 0; Y < CurrentFloor.Height; Y++) {
-      for (int32_t X = 0; X < CurrentFloor.Width; X++) {
-        // 아래층이 벽이면 현재 층도 벽이어야 함 (플레이어 추락 방지)
-        if (BelowFloor.GetTile(X, Y).Type == ETileType::Wall &&
-            CurrentFloor.GetTile(X, Y).Type != ETileType::Wall) {
-          CurrentFloor.GetTile(X, Y).Type = ETileType::Wall;
-        }
+    // 타입 평면끼리 직접 비교 (두 층의 크기는 같음)
+    const auto &Current = CurrentFloor.Types;
+    const auto &Below = BelowFloor.Types;
+    const size_t Count = CurrentFloor.Num();
+    for (size_t i = 0; i < Count; i++) {
+      // 아래층이 벽이면 현재 층도 벽이어야 함 (플레이어 추락 방지)
+      if (Below[i] == ETileType::Wall) {
+        Current[i] = ETileType::Wall;
       }
     }
   }
@@ -202,55 +240,72 @@ CoreBSPGenerator::PlaceStairs(CoreMultiFloorDungeon &MultiFloor,
                               const CoreMultiFloorConfig &Config,
                               IRandom &Random, ILogger *Logger) {
   std::vector<CoreStairPosition> AllStairs;
-  float MinDistSq = Config.MinStairDistance * Config.MinStairDistance;
+  const float MinDistSq = Config.MinStairDistance * Config.MinStairDistance;
 
-  for (int32_t Floor = 0; Floor < MultiFloor.NumFloors - 1; Floor++) {
-    std::vector<FIntPoint> ValidPositions;
-    for (int32_t Y = 0; Y < MultiFloor.Floors[Floor].Height; Y++) {
-      for (int32_t X = 0; X < MultiFloor.Floors[Floor].Width; X++) {
-        // 두 층 모두 바닥인 곳만 계단 설치 가능
-        bool bCurrentFloor =
-            MultiFloor.Floors[Floor].GetTile(X, Y).Type != ETileType::Wall;
-        bool bNextFloor =
-            MultiFloor.Floors[Floor + 1].GetTile(X, Y).Type != ETileType::Wall;
-
-        if (bCurrentFloor && bNextFloor) {
-          ValidPositions.push_back(FIntPoint(X, Y));
-        }
-      }
-    }
+  // 무작위 추출 단계에서 계단 하나당 허용하는 추출 횟수
+  constexpr int32_t DrawsPerStair = 32;
 
-    if (ValidPositions.empty())
+  // 층마다 다시 채우는 후보 버퍼 (타일 인덱스, 추출이 모자랄 때만 사용)
+  std::vector<uint32_t> ValidPositions;
+  for (int32_t Floor = 0; Floor < MultiFloor.NumFloors - 1; Floor++) {
+    const CoreDungeonGrid &Current = MultiFloor.Floors[Floor];
+    const CoreDungeonGrid &Next = MultiFloor.Floors[Floor + 1];
+    const int32_t Count = (int32_t)Current.Num();
+    if (Count == 0)
       continue;
 
-    // 셔플
-    for (size_t i = ValidPositions.size() - 1; i > 0; i--) {
-      size_t j = Random.RandRange(0, (int32_t)i);
-      std::swap(ValidPositions[i], ValidPositions[j]);
-    }
+    // 두 층 모두 바닥인 곳만 계단 설치 가능 (두 층의 크기는 같음)
+    auto IsValidPosition = [&](uint32_t Index) {
+      return Current.Types[Index] != ETileType::Wall &&
+             Next.Types[Index] != ETileType::Wall;
+    };
 
+    // 같은 층 계단과 최소 거리 검사 후 배치 (같은 칸은 항상 제외)
+    const size_t FirstStair = AllStairs.size();
     int32_t StairsPlaced = 0;
-    for (const auto &Pos : ValidPositions) {
-      if (StairsPlaced >= Config.StairsPerFloor)
-        break;
-
-      bool bTooClose = false;
-      for (const auto &Stair : AllStairs) {
-        if (Stair.FloorIndex == Floor) {
-          float DistSq =
-              std::pow(Pos.X - Stair.X, 2) + std::pow(Pos.Y - Stair.Y, 2);
-          if (DistSq < MinDistSq) {
-            bTooClose = true;
-            break;
-          }
+    auto TryPlaceStair = [&](uint32_t Index) {
+      const int32_t X = (int32_t)(Index % Current.Width);
+      const int32_t Y = (int32_t)(Index / Current.Width);
+      for (size_t k = FirstStair; k < AllStairs.size(); k++) {
+        const int32_t DX = X - AllStairs[k].X;
+        const int32_t DY = Y - AllStairs[k].Y;
+        const int32_t DistSq = DX * DX + DY * DY;
+        if (DistSq == 0 || (float)DistSq < MinDistSq) {
+          return;
         }
       }
+      AllStairs.push_back({Floor, X, Y, Floor + 1});
+      StairsPlaced++;
+    };
+
+    // 1. 무작위 타일을 뽑아 바로 검사 (바닥이 흔하면 전체 스캔 없이 끝남)
+    const int32_t MaxDraws = Config.StairsPerFloor * DrawsPerStair;
+    for (int32_t Draw = 0;
+         Draw < MaxDraws && StairsPlaced < Config.StairsPerFloor; Draw++) {
+      const uint32_t Index = (uint32_t)Random.RandRange(0, Count - 1);
+      if (IsValidPosition(Index)) {
+        TryPlaceStair(Index);
+      }
+    }
+    if (StairsPlaced >= Config.StairsPerFloor)
+      continue;
 
-      if (!bTooClose) {
-        AllStairs.push_back({Floor, Pos.X, Pos.Y, Floor + 1});
-        StairsPlaced++;
+    // 2. 바닥이 드물거나 거리 제한에 자주 걸리면 후보 목록을 만들어
+    // 부분 셔플 (필요한 만큼만 남은 후보 중 균등 선택)
+    ValidPositions.clear();
+    for (int32_t i = 0; i < Count; i++) {
+      if (IsValidPosition((uint32_t)i)) {
+        ValidPositions.push_back((uint32_t)i);
       }
     }
+    for (size_t i = 0;
+         i < ValidPositions.size() && StairsPlaced < Config.StairsPerFloor;
+         i++) {
+      const size_t j = Random.RandRange(
+          (int32_t)i, (int32_t)ValidPositions.size() - 1);
+      std::swap(ValidPositions[i], ValidPositions[j]);
+      TryPlaceStair(ValidPositions[i]);
+    }
   }
   return AllStairs;
 }
@@ -4,160 +4,423 @@
 
 namespace DungeonCore {
 
-// 공간 해싱을 위한 그리드 구조체
-struct CoreSpatialGrid {
-  std::map<int32_t, std::vector<FIntPoint>> Cells;
-  int32_t CellSize;
-  int32_t GridWidth;
-
-  CoreSpatialGrid(int32_t InCellSize, int32_t InGridWidth)
-      : CellSize(InCellSize), GridWidth(InGridWidth) {}
+namespace {
+// 원판을 반폭이 같은 연속 행끼리 묶은 직사각형 띠 (DY0 ~ DY1, -HalfWidth ~ +HalfWidth)
+struct CoreDiscBand {
+  int32_t DY0;
+  int32_t DY1;
+  int32_t HalfWidth;
+};
 
-  int32_t GetCellKey(int32_t X, int32_t Y) const {
-    return (X / CellSize) * 10000 + (Y / CellSize);
-  }
+std::vector<CoreDiscBand> BuildDiscBands(float Radius) {
+  std::vector<CoreDiscBand> Bands;
+  const int32_t R = Radius > 0.0f ? (int32_t)Radius : 0;
+  const float RadiusSq = Radius * Radius;
 
-  void AddTile(int32_t X, int32_t Y) {
-    Cells[GetCellKey(X, Y)].push_back(FIntPoint(X, Y));
-  }
+  for (int32_t DY = -R; DY <= R; DY++) {
+    int32_t HalfWidth = R;
+    while (HalfWidth > 0 &&
+           (float)(HalfWidth * HalfWidth + DY * DY) > RadiusSq) {
+      HalfWidth--;
+    }
 
-  void QueryRadius(int32_t X, int32_t Y, float Radius,
-                   std::vector<FIntPoint> &OutTiles) const {
-    int32_t MinCellX = (int32_t)((X - Radius) / CellSize);
-    int32_t MaxCellX = (int32_t)((X + Radius) / CellSize);
-    int32_t MinCellY = (int32_t)((Y - Radius) / CellSize);
-    int32_t MaxCellY = (int32_t)((Y + Radius) / CellSize);
-
-    for (int32_t CY = MinCellY; CY <= MaxCellY; CY++) {
-      for (int32_t CX = MinCellX; CX <= MaxCellX; CX++) {
-        int32_t Key = CX * 10000 + CY;
-        auto It = Cells.find(Key);
-        if (It != Cells.end()) {
-          OutTiles.insert(OutTiles.end(), It->second.begin(), It->second.end());
-        }
-      }
+    if (!Bands.empty() && Bands.back().HalfWidth == HalfWidth) {
+      Bands.back().DY1 = DY;
+    } else {
+      Bands.push_back({DY, DY, HalfWidth});
     }
   }
-};
+  return Bands;
+}
+} // namespace
 
 void CoreObjectPlacer::CalculateMonsterZones(CoreDungeonGrid &Grid,
                                              float CheckRadius,
                                              int32_t MinOpenSpace,
-                                             ILogger *Logger) {
-  // 공간 해싱 최적화 적용
-  CoreSpatialGrid SpatialGrid((int32_t)CheckRadius, Grid.Width);
-
-  for (int32_t Y = 0; Y < Grid.Height; Y++) {
-    for (int32_t X = 0; X < Grid.Width; X++) {
-      if (Grid.GetTile(X, Y).Type == ETileType::Floor) {
-        SpatialGrid.AddTile(X, Y);
+                                             ILogger *Logger,
+                                             IExecutor *Executor) {
+  const int32_t Width = Grid.Width;
+  const int32_t Height = Grid.Height;
+  if (Width <= 0 || Height <= 0)
+    return;
+
+  const std::vector<CoreDiscBand> Bands = BuildDiscBands(CheckRadius);
+  const int32_t R = -Bands.front().DY0;
+
+  // 1. 바닥 타일 적분 영상 (Summed-Area Table)
+  // 사방으로 R만큼 0을 덧대서 원판이 그리드 밖으로 나가도 경계 검사가 필요 없음
+  const int32_t SatWidth = Width + 2 * R + 1;
+  const int32_t SatHeight = Height + 2 * R + 1;
+  std::vector<int32_t> Sat(static_cast<size_t>(SatWidth) * SatHeight, 0);
+  for (int32_t Y = 0; Y < Height + R; Y++) {
+    const int32_t *Above = Sat.data() + static_cast<size_t>(Y + R) * SatWidth;
+    int32_t *Row = Sat.data() + static_cast<size_t>(Y + R + 1) * SatWidth;
+    int32_t RowSum = 0;
+    if (Y < Height) {
+      for (int32_t X = 0; X < Width; X++) {
+        RowSum += Grid.Types[Grid.GetIndex(X, Y)] == ETileType::Floor;
+        Row[X + R + 1] = Above[X + R + 1] + RowSum;
+      }
+    } else {
+      for (int32_t X = 0; X < Width; X++) {
+        Row[X + R + 1] = Above[X + R + 1];
       }
     }
+    // 오른쪽 여백은 행 누적값 그대로 (왼쪽 여백은 0)
+    for (int32_t SX = Width + R + 1; SX < SatWidth; SX++) {
+      Row[SX] = Above[SX] + RowSum;
+    }
   }
 
-  float RadiusSq = CheckRadius * CheckRadius;
+  // 직사각형 합 = 네 모서리 조회. 타일 (X, Y)의 기준 인덱스에 대한 상대 오프셋
+  struct SatRect {
+    ptrdiff_t BottomRight, BottomLeft, TopRight, TopLeft;
+  };
+  auto MakeRect = [SatWidth](int32_t DY0, int32_t DY1, int32_t HalfWidth) {
+    return SatRect{(ptrdiff_t)(DY1 + 1) * SatWidth + HalfWidth + 1,
+                   (ptrdiff_t)(DY1 + 1) * SatWidth - HalfWidth,
+                   (ptrdiff_t)DY0 * SatWidth + HalfWidth + 1,
+                   (ptrdiff_t)DY0 * SatWidth - HalfWidth};
+  };
 
-  // 순차 루프 (서버용 단순 구현, 필요시 병렬 처리 주입 가능)
-  for (int32_t Y = 0; Y < Grid.Height; Y++) {
-    for (int32_t X = 0; X < Grid.Width; X++) {
-      FCoreTile &Tile = Grid.GetTile(X, Y);
-      if (Tile.Type != ETileType::Floor) {
-        Tile.MonsterSuitability = 0.0f;
-        continue;
-      }
+  // 2. 반경 내 바닥 수 = 원판 띠별 직사각형 합 (타일당 띠 수 x 4번 조회)
+  std::vector<SatRect> DiscRects;
+  DiscRects.reserve(Bands.size());
+  for (const CoreDiscBand &Band : Bands) {
+    DiscRects.push_back(MakeRect(Band.DY0, Band.DY1, Band.HalfWidth));
+  }
+  // 주변 = 원판의 외접 사각형
+  const SatRect NearbyRect = MakeRect(-R, R, R);
 
-      std::vector<FIntPoint> NearbyTiles;
-      SpatialGrid.QueryRadius(X, Y, CheckRadius, NearbyTiles);
+  auto &SuitabilityPlane = Grid.EnsureSuitabilityPlane();
 
-      int32_t OpenCount = 0;
-      for (const auto &Pt : NearbyTiles) {
-        float DistSq = std::pow(X - Pt.X, 2) + std::pow(Y - Pt.Y, 2);
-        if (DistSq <= RadiusSq) {
-          OpenCount++;
+  auto ProcessRows = [&](int32_t RowBegin, int32_t RowEnd) {
+    std::vector<int32_t> OpenCounts(Width);
+    for (int32_t Y = RowBegin; Y < RowEnd; Y++) {
+      // 행 전체를 띠 단위로 누적 (분기 없는 내부 루프)
+      const int32_t *Base = Sat.data() + static_cast<size_t>(Y + R) * SatWidth + R;
+      int32_t *Counts = OpenCounts.data();
+      std::fill(OpenCounts.begin(), OpenCounts.end(), 0);
+      for (const SatRect &Rect : DiscRects) {
+        const int32_t *BR = Base + Rect.BottomRight;
+        const int32_t *BL = Base + Rect.BottomLeft;
+        const int32_t *TR = Base + Rect.TopRight;
+        const int32_t *TL = Base + Rect.TopLeft;
+        for (int32_t X = 0; X < Width; X++) {
+          Counts[X] += BR[X] - BL[X] - TR[X] + TL[X];
         }
       }
 
-      if (!NearbyTiles.empty() && OpenCount >= MinOpenSpace) {
-        float Ratio = (float)OpenCount / NearbyTiles.size();
+      for (int32_t X = 0; X < Width; X++) {
+        const size_t Index = Grid.GetIndex(X, Y);
+        float &TileSuitability = SuitabilityPlane[Index];
+        const int32_t OpenCount = OpenCounts[X];
+        if (Grid.Types[Index] != ETileType::Floor ||
+            OpenCount < MinOpenSpace) {
+          TileSuitability = 0.0f;
+          continue;
+        }
+        if (MinOpenSpace <= 0) {
+          TileSuitability = 1.0f;
+          continue;
+        }
+
+        // 주변 바닥 중 반경 안에 드는 비율 + 여유 공간 보너스
+        const int32_t *P = Base + X;
+        const int32_t NearbyCount =
+            P[NearbyRect.BottomRight] - P[NearbyRect.BottomLeft] -
+            P[NearbyRect.TopRight] + P[NearbyRect.TopLeft];
+        float Ratio = (float)OpenCount / NearbyCount;
         float Bonus = (float)(OpenCount - MinOpenSpace) / MinOpenSpace;
         float Suitability = Ratio + Bonus * 0.2f;
-        Tile.MonsterSuitability =
-            Suitability > 1.0f ? 1.0f
-                               : (Suitability < 0.0f ? 0.0f : Suitability);
-      } else {
-        Tile.MonsterSuitability = 0.0f;
+        TileSuitability = Suitability > 1.0f
+                              ? 1.0f
+                              : (Suitability < 0.0f ? 0.0f : Suitability);
       }
     }
+  };
+
+  // 3. 행 묶음 단위 병렬 처리 (각 묶음은 자기 행의 적합도만 씀)
+  constexpr int32_t RowsPerBand = 64;
+  const int32_t NumRowBands = (Height + RowsPerBand - 1) / RowsPerBand;
+  if (Executor && NumRowBands > 1) {
+    Executor->ParallelFor(NumRowBands, [&](int32_t BandIndex) {
+      const int32_t RowBegin = BandIndex * RowsPerBand;
+      ProcessRows(RowBegin, std::min(RowBegin + RowsPerBand, Height));
+    });
+  } else {
+    ProcessRows(0, Height);
+  }
+
+  if (Logger) {
+    Logger->LogInfo("CalculateMonsterZones: %dx%d grid, radius %.1f (%d bands)",
+                    Width, Height, CheckRadius, (int32_t)Bands.size());
   }
 }
 
-bool CoreObjectPlacer::CheckPropDiversity(
-    float X, float Y, ECorePropType Type,
-    const std::map<ECorePropType, std::vector<CorePropData>> &PropsByType,
-    float Radius) {
-  auto It = PropsByType.find(Type);
-  if (It == PropsByType.end())
-    return true;
+namespace {
+// 프롭 배경 격자 셀 (Tile == -1이면 비어 있음)
+struct CorePropCell {
+  int32_t Tile = -1;   // 프롭 타일 인덱스 (Y * Width + X)
+  int32_t Config = -1; // 프롭 설정 인덱스
+};
+
+// 포아송 디스크 배경 격자
+// 셀 크기 = BlockSize / CellsPerBlock <= 최소 간격 / sqrt(2) 이므로 셀당 프롭은
+// 최대 1개. 셀 경계가 블록 경계와 일치해서 각 셀은 정확히 한 블록에 속함
+struct CorePropGrid {
+  int32_t BlockSize = 1;
+  int32_t CellsPerBlock = 1;
+  int32_t CellsX = 0;
+  int32_t CellsY = 0;
+  int32_t QueryRange = 0; // 검사할 타일 반경 (최대 간격 올림)
+  std::vector<CorePropCell> Cells;
+
+  bool IsEnabled() const { return !Cells.empty(); }
+
+  void Init(int32_t Width, int32_t Height, int32_t InBlockSize,
+            float MinSpacing, float MaxSpacing) {
+    Cells.clear();
+    // 서로 다른 타일은 항상 1 이상 떨어져 있으므로 검사 불필요
+    if (MaxSpacing <= 1.0f)
+      return;
+
+    BlockSize = InBlockSize;
+    // 타일 하나보다 작은 셀은 의미 없음 (한 타일에는 프롭 하나)
+    const float CellSize = std::max(MinSpacing / std::sqrt(2.0f), 1.0f);
+    CellsPerBlock = std::max(1, (int32_t)std::ceil(BlockSize / CellSize));
+    CellsX = CellIndex(Width - 1) + 1;
+    CellsY = CellIndex(Height - 1) + 1;
+    QueryRange = (int32_t)std::ceil(MaxSpacing);
+    Cells.assign(static_cast<size_t>(CellsX) * CellsY, CorePropCell());
+  }
+
+  int32_t CellIndex(int32_t Coord) const {
+    return (int32_t)((int64_t)Coord * CellsPerBlock / BlockSize);
+  }
+
+  CorePropCell &At(int32_t X, int32_t Y) {
+    return Cells[static_cast<size_t>(CellIndex(Y)) * CellsX + CellIndex(X)];
+  }
 
-  float RadiusSq = Radius * Radius;
-  for (const auto &Prop : It->second) {
-    float DistSq =
-        std::pow(X - (Prop.X + 0.5f), 2) + std::pow(Y - (Prop.Y + 0.5f), 2);
-    if (DistSq < RadiusSq)
-      return false;
+  // 주변 셀의 프롭마다 Visit 호출, Visit이 false를 반환하면 false
+  template <typename VisitFn>
+  bool ForEachNear(int32_t X, int32_t Y, int32_t Width, int32_t Height,
+                   VisitFn &&Visit) const {
+    const int32_t CX0 = CellIndex(std::max(0, X - QueryRange));
+    const int32_t CX1 = CellIndex(std::min(Width - 1, X + QueryRange));
+    const int32_t CY0 = CellIndex(std::max(0, Y - QueryRange));
+    const int32_t CY1 = CellIndex(std::min(Height - 1, Y + QueryRange));
+    for (int32_t CY = CY0; CY <= CY1; CY++) {
+      const CorePropCell *Row = Cells.data() + static_cast<size_t>(CY) * CellsX;
+      for (int32_t CX = CX0; CX <= CX1; CX++) {
+        if (Row[CX].Tile >= 0 && !Visit(Row[CX])) {
+          return false;
+        }
+      }
+    }
+    return true;
   }
-  return true;
+};
+
+// 블록별 독립 시드 (블록 번호만으로 결정되어 실행 순서와 무관)
+int32_t DeriveBlockSeed(int32_t BaseSeed, int32_t BlockIndex) {
+  return (int32_t)((uint32_t)BaseSeed ^ ((uint32_t)BlockIndex * 0x9E3779B1u));
 }
+} // namespace
 
 std::vector<CorePropData> CoreObjectPlacer::GenerateProps(
     const CoreDungeonGrid &Grid, const std::vector<CorePropConfig> &Configs,
-    IRandom &Random, bool bEnforceDiversity, ILogger *Logger) {
+    IRandom &Random, bool bEnforceDiversity, ILogger *Logger,
+    IExecutor *Executor) {
   std::vector<CorePropData> Props;
-  if (Configs.empty())
+  if (Configs.empty() || Grid.Width <= 0 || Grid.Height <= 0)
     return Props;
 
+  const int32_t Width = Grid.Width;
+  const int32_t Height = Grid.Height;
+  const int32_t NumConfigs = (int32_t)Configs.size();
+
   float TotalProb = 0.0f;
   for (const auto &Cfg : Configs)
     TotalProb += Cfg.Probability;
 
-  std::map<ECorePropType, std::vector<CorePropData>> PropsByType;
-  int32_t PropIDCounter = 0;
-
-  // 포아송 디스크 샘플링 유사 방식 (단순화됨)
-  int32_t MaxPoints = 1000;
-  for (int32_t i = 0; i < MaxPoints; i++) {
-    int32_t X = Random.RandRange(0, Grid.Width - 1);
-    int32_t Y = Random.RandRange(0, Grid.Height - 1);
-
-    if (!Grid.IsValid(X, Y) || Grid.GetTile(X, Y).Type != ETileType::Floor)
-      continue;
-
-    // 유형 선택
-    float Roll = Random.GetFraction() * TotalProb;
-    float Cumulative = 0.0f;
-    const CorePropConfig *SelectedConfig = &Configs[0];
-    for (const auto &Cfg : Configs) {
-      Cumulative += Cfg.Probability;
-      if (Roll <= Cumulative) {
-        SelectedConfig = &Cfg;
-        break;
+  // 1. 간격 범위: MinDistance는 모든 프롭 사이, AvoidSameTypeRadius는 같은 유형끼리
+  float MinSpacing = Configs[0].MinDistance;
+  float MaxSpacing = Configs[0].MinDistance;
+  std::vector<ECorePropType> Types; // 유형별 격자 순서
+  std::vector<int32_t> ConfigTypeGrid(NumConfigs, -1);
+  for (int32_t i = 0; i < NumConfigs; i++) {
+    MinSpacing = std::min(MinSpacing, Configs[i].MinDistance);
+    MaxSpacing = std::max(MaxSpacing, Configs[i].MinDistance);
+
+    auto It = std::find(Types.begin(), Types.end(), Configs[i].Type);
+    ConfigTypeGrid[i] = (int32_t)(It - Types.begin());
+    if (It == Types.end())
+      Types.push_back(Configs[i].Type);
+  }
+
+  // 2. 블록 분할: 블록 크기 >= 최대 검사 반경이면 2x2 패리티가 같은 블록끼리는
+  // 서로의 셀을 읽지도 쓰지도 않으므로 동시에 처리 가능
+  int32_t MaxQuery = (int32_t)std::ceil(MaxSpacing);
+  std::vector<float> TypeMinSpacing(Types.size(), 0.0f);
+  std::vector<float> TypeMaxSpacing(Types.size(), 0.0f);
+  if (bEnforceDiversity) {
+    std::vector<bool> bSeen(Types.size(), false);
+    for (int32_t i = 0; i < NumConfigs; i++) {
+      const int32_t T = ConfigTypeGrid[i];
+      const float Radius = Configs[i].AvoidSameTypeRadius;
+      TypeMinSpacing[T] = bSeen[T] ? std::min(TypeMinSpacing[T], Radius) : Radius;
+      TypeMaxSpacing[T] = bSeen[T] ? std::max(TypeMaxSpacing[T], Radius) : Radius;
+      bSeen[T] = true;
+      MaxQuery = std::max(MaxQuery, (int32_t)std::ceil(Radius));
+    }
+  }
+
+  const int32_t BlockSize = std::max(32, MaxQuery);
+  const int32_t BlocksX = (Width + BlockSize - 1) / BlockSize;
+  const int32_t BlocksY = (Height + BlockSize - 1) / BlockSize;
+  const int32_t NumBlocks = BlocksX * BlocksY;
+
+  CorePropGrid SpacingGrid;
+  SpacingGrid.Init(Width, Height, BlockSize, MinSpacing, MaxSpacing);
+  std::vector<CorePropGrid> TypeGrids(Types.size());
+  for (size_t T = 0; T < TypeGrids.size(); T++) {
+    TypeGrids[T].Init(Width, Height, BlockSize, TypeMinSpacing[T],
+                      TypeMaxSpacing[T]);
+  }
+
+  // 3. 블록별 포아송 디스크: 블록 안의 모든 바닥 타일을 섞어서 한 번씩 시도
+  // (시도 횟수 = 바닥 면적)
+  const int32_t BaseSeed = Random.RandRange(0, 0x3FFFFFFF);
+  std::vector<std::vector<CorePropData>> BlockProps(NumBlocks);
+
+  auto ProcessBlock = [&](int32_t BlockIndex) {
+    const int32_t BX0 = (BlockIndex % BlocksX) * BlockSize;
+    const int32_t BY0 = (BlockIndex / BlocksX) * BlockSize;
+    const int32_t BX1 = std::min(BX0 + BlockSize, Width);
+    const int32_t BY1 = std::min(BY0 + BlockSize, Height);
+
+    std::vector<int32_t> Candidates;
+    Candidates.reserve(static_cast<size_t>(BX1 - BX0) * (BY1 - BY0));
+    for (int32_t Y = BY0; Y < BY1; Y++) {
+      for (int32_t X = BX0; X < BX1; X++) {
+        if (Grid.Types[Grid.GetIndex(X, Y)] == ETileType::Floor)
+          Candidates.push_back(Y * Width + X);
       }
     }
+    if (Candidates.empty())
+      return;
 
-    // 다양성 체크
-    if (bEnforceDiversity) {
-      if (!CheckPropDiversity(X + 0.5f, Y + 0.5f, SelectedConfig->Type,
-                              PropsByType,
-                              SelectedConfig->AvoidSameTypeRadius)) {
-        continue;
+    std::unique_ptr<IRandom> BlockRandom =
+        Random.CreateChild(DeriveBlockSeed(BaseSeed, BlockIndex));
+    for (int32_t i = (int32_t)Candidates.size() - 1; i > 0; i--) {
+      std::swap(Candidates[i], Candidates[BlockRandom->RandRange(0, i)]);
+    }
+
+    std::vector<CorePropData> &OutProps = BlockProps[BlockIndex];
+    for (const int32_t Tile : Candidates) {
+      const int32_t X = Tile % Width;
+      const int32_t Y = Tile / Width;
+
+      // 유형 선택
+      float Roll = BlockRandom->GetFraction() * TotalProb;
+      float Cumulative = 0.0f;
+      int32_t Selected = 0;
+      for (int32_t i = 0; i < NumConfigs; i++) {
+        Cumulative += Configs[i].Probability;
+        if (Roll <= Cumulative) {
+          Selected = i;
+          break;
+        }
       }
+      const CorePropConfig &Cfg = Configs[Selected];
+
+      // 크기만큼 바닥이 확보되는지
+      bool bFits = true;
+      for (int32_t DY = 0; DY < Cfg.Size && bFits; DY++) {
+        for (int32_t DX = 0; DX < Cfg.Size; DX++) {
+          if (!Grid.IsValid(X + DX, Y + DY) ||
+              Grid.GetType(X + DX, Y + DY) != ETileType::Floor) {
+            bFits = false;
+            break;
+          }
+        }
+      }
+      if (!bFits)
+        continue;
+
+      // 모든 프롭과의 최소 거리 (둘 중 큰 MinDistance 기준)
+      auto IsFarEnough = [&](const CorePropCell &Cell, float Radius) {
+        const int32_t DX = Cell.Tile % Width - X;
+        const int32_t DY = Cell.Tile / Width - Y;
+        return (float)(DX * DX + DY * DY) >= Radius * Radius;
+      };
+      if (SpacingGrid.IsEnabled() &&
+          !SpacingGrid.ForEachNear(X, Y, Width, Height,
+                                   [&](const CorePropCell &Cell) {
+                                     return IsFarEnough(
+                                         Cell,
+                                         std::max(Cfg.MinDistance,
+                                                  Configs[Cell.Config]
+                                                      .MinDistance));
+                                   }))
+        continue;
+
+      // 다양성 체크 (동일 유형이 너무 가까이 있는지)
+      CorePropGrid *TypeGrid =
+          bEnforceDiversity ? &TypeGrids[ConfigTypeGrid[Selected]] : nullptr;
+      if (TypeGrid && TypeGrid->IsEnabled() &&
+          !TypeGrid->ForEachNear(X, Y, Width, Height,
+                                 [&](const CorePropCell &Cell) {
+                                   return IsFarEnough(Cell,
+                                                      Cfg.AvoidSameTypeRadius);
+                                 }))
+        continue;
+
+      if (SpacingGrid.IsEnabled())
+        SpacingGrid.At(X, Y) = {Tile, Selected};
+      if (TypeGrid && TypeGrid->IsEnabled())
+        TypeGrid->At(X, Y) = {Tile, Selected};
+
+      OutProps.push_back({0, Cfg.Type, X, Y});
     }
+  };
 
-    CorePropData NewProp = {PropIDCounter++, SelectedConfig->Type, X, Y};
-    Props.push_back(NewProp);
-    PropsByType[NewProp.Type].push_back(NewProp);
+  for (int32_t Phase = 0; Phase < 4; Phase++) {
+    std::vector<int32_t> PhaseBlocks;
+    for (int32_t BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++) {
+      const int32_t BX = BlockIndex % BlocksX;
+      const int32_t BY = BlockIndex / BlocksX;
+      if (((BX & 1) | ((BY & 1) << 1)) == Phase)
+        PhaseBlocks.push_back(BlockIndex);
+    }
+
+    if (Executor && PhaseBlocks.size() > 1) {
+      Executor->ParallelFor((int32_t)PhaseBlocks.size(),
+                            [&](int32_t i) { ProcessBlock(PhaseBlocks[i]); });
+    } else {
+      for (const int32_t BlockIndex : PhaseBlocks)
+        ProcessBlock(BlockIndex);
+    }
   }
 
+  // 4. 블록 순서대로 합치고 ID 부여 (실행 순서와 무관하게 같은 결과)
+  size_t NumProps = 0;
+  for (const auto &Block : BlockProps)
+    NumProps += Block.size();
+  Props.reserve(NumProps);
+  for (const auto &Block : BlockProps) {
+    for (const CorePropData &Prop : Block) {
+      Props.push_back(Prop);
+      Props.back().ID = (int32_t)Props.size() - 1;
+    }
+  }
+
+  if (Logger) {
+    Logger->LogInfo("GenerateProps: Placed %d props (%d blocks of %d)",
+                    (int32_t)Props.size(), NumBlocks, BlockSize);
+  }
   return Props;
 }
 
@@ -8,11 +8,13 @@
 
 namespace DungeonCore {
 
-// BSP 트리 노드 구조체
+// BSP 트리 노드 구조체 (CoreBSPGenerator의 노드 배열에 저장, 자식은 인덱스로 연결)
 struct CoreBSPNode {
+  static constexpr int32_t InvalidIndex = -1;
+
   int32_t X, Y, Width, Height;
-  std::shared_ptr<CoreBSPNode> Left;
-  std::shared_ptr<CoreBSPNode> Right;
+  int32_t Left = InvalidIndex;
+  int32_t Right = InvalidIndex;
   int32_t RoomX, RoomY, RoomWidth, RoomHeight;
   bool bIsLeaf = true;
 
@@ -55,13 +57,22 @@ public:
   int32_t CorridorWidth = 3; // 복도 폭 (1 이상, 3 권장)
 
   // 단일 층 생성
+  // 노드 배열과 작업 스택은 호출 간 재사용 (같은 인스턴스로 반복 생성 시
+  // 용량이 충분하면 할당 없음)
   void Generate(CoreDungeonGrid &Grid, IRandom &Random,
                 ILogger *Logger = nullptr);
 
-  // 다층 던전 생성 (순차적)
+  // 다층 던전 생성
+  // 각 층은 DeriveFloorSeed로 얻은 독립 난수로 생성되므로 Executor 유무와
+  // 관계없이 같은 시드면 같은 결과. 계단 배치는 Random으로 순차 처리
   static CoreMultiFloorDungeon
   GenerateMultiFloor(const CoreMultiFloorConfig &Config, IRandom &Random,
-                     ILogger *Logger = nullptr);
+                     ILogger *Logger = nullptr, IExecutor *Executor = nullptr);
+
+  // 층별 시드 (UE 래퍼와 같은 규칙)
+  static int32_t DeriveFloorSeed(int32_t BaseSeed, int32_t FloorIndex) {
+    return BaseSeed + FloorIndex * 1000;
+  }
 
   // 헬퍼 함수들 (커스텀 파이프라인 구성을 위해 공개)
   static void EnforceVerticalAlignment(CoreMultiFloorDungeon &MultiFloor,
@@ -72,15 +83,19 @@ public:
               ILogger *Logger);
   static void MarkStairTiles(CoreMultiFloorDungeon &MultiFloor);
 
+  // 마지막 Generate의 트리 (0번이 루트, 자식 인덱스는 항상 부모보다 큼)
+  const std::vector<CoreBSPNode> &GetNodes() const { return Nodes; }
+
 private:
-  void SplitNode(std::shared_ptr<CoreBSPNode> Node, IRandom &Random,
-                 ILogger *Logger);
-  void CreateRooms(std::shared_ptr<CoreBSPNode> Node, CoreDungeonGrid &Grid,
-                   IRandom &Random);
-  void ConnectRooms(std::shared_ptr<CoreBSPNode> Node, CoreDungeonGrid &Grid,
-                    IRandom &Random);
+  void SplitNodes(IRandom &Random);
+  void CreateRooms(CoreDungeonGrid &Grid, IRandom &Random);
+  void ConnectRooms(CoreDungeonGrid &Grid);
   void CreateCorridor(CoreDungeonGrid &Grid, int32_t X1, int32_t Y1,
                       int32_t X2, int32_t Y2);
+
+  std::vector<CoreBSPNode> Nodes;
+  std::vector<int32_t> NodeStack; // 분할 대기 노드 (전위 순회 순서 유지)
+  std::vector<int32_t> Leaves;    // 리프 노드 (왼쪽 -> 오른쪽 순)
 };
 
 } // namespace DungeonCore
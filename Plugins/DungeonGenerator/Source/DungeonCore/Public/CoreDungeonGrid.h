@@ -1,17 +1,100 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace DungeonCore {
 
-// 핵심 던전 그리드 데이터 구조 (std::vector 사용)
+// 타일 평면 (바이트 단위 간격을 가진 포인터)
+// - 소유 평면: CoreDungeonGrid 내부 vector, Stride == sizeof(T)
+// - 외부 뷰: 다른 타일 구조체 배열의 필드, Stride == 구조체 크기
+// Data == nullptr이면 미할당 (모든 타일이 기본값)
+template <typename T> struct CoreTilePlane {
+  T *Data = nullptr;
+  size_t Stride = sizeof(T);
+
+  bool IsAllocated() const { return Data != nullptr; }
+  bool IsContiguous() const { return Stride == sizeof(T); }
+
+  T &operator[](size_t Index) const {
+    return *reinterpret_cast<T *>(reinterpret_cast<char *>(Data) +
+                                  Index * Stride);
+  }
+};
+
+// 선택적 타일 평면 원소 참조 (쓰기 시에만 평면 할당)
+template <typename T> class CoreTilePlaneRef {
+public:
+  CoreTilePlaneRef(CoreTilePlane<T> &InPlane, std::vector<T> &InStorage,
+                   size_t InIndex, size_t InCount, T InDefault)
+      : Plane(InPlane), Storage(InStorage), Index(InIndex), Count(InCount),
+        Default(InDefault) {}
+
+  operator T() const { return Plane.IsAllocated() ? Plane[Index] : Default; }
+
+  CoreTilePlaneRef &operator=(T Value) {
+    if (!Plane.IsAllocated()) {
+      if (Value == Default)
+        return *this;
+      Storage.assign(Count, Default);
+      Plane.Data = Storage.data();
+      Plane.Stride = sizeof(T);
+    }
+    Plane[Index] = Value;
+    return *this;
+  }
+
+  CoreTilePlaneRef &operator=(const CoreTilePlaneRef &Other) {
+    return *this = static_cast<T>(Other);
+  }
+
+private:
+  CoreTilePlane<T> &Plane;
+  std::vector<T> &Storage;
+  size_t Index;
+  size_t Count;
+  T Default;
+};
+
+// GetTile()이 반환하는 타일 뷰 (기존 FCoreTile 필드명 유지)
+struct CoreTileRef {
+  const int32_t X;
+  const int32_t Y;
+  ETileType &Type;
+  CoreTilePlaneRef<int32_t> RoomID;
+  CoreTilePlaneRef<float> MonsterSuitability;
+  CoreTilePlaneRef<int32_t> StairTargetFloor;
+
+  operator FCoreTile() const {
+    FCoreTile Tile;
+    Tile.X = X;
+    Tile.Y = Y;
+    Tile.Type = Type;
+    Tile.RoomID = RoomID;
+    Tile.MonsterSuitability = MonsterSuitability;
+    Tile.StairTargetFloor = StairTargetFloor;
+    return Tile;
+  }
+};
+
+// 핵심 던전 그리드 데이터 구조 (구조체 배열 대신 평면 배열 사용)
+// - Types: 타일당 1바이트, 항상 존재
+// - RoomIDs / Suitability / StairTargets: 기본값이 아닌 값을 처음 쓸 때 할당
+//
+// MakeView()로 만든 그리드는 외부 메모리(예: FDungeonGrid의 타일 배열)를
+// 복사 없이 직접 읽고 씀. 뷰를 복사하면 같은 메모리를 가리키는 뷰가 됨
 class CoreDungeonGrid {
 public:
   int32_t Width;
   int32_t Height;
-  std::vector<FCoreTile> Tiles;
+
+  CoreTilePlane<ETileType> Types;
+  CoreTilePlane<int32_t> RoomIDs;
+  CoreTilePlane<float> Suitability;
+  CoreTilePlane<int32_t> StairTargets;
 
   CoreDungeonGrid() : Width(0), Height(0) {}
   CoreDungeonGrid(int32_t InWidth, int32_t InHeight,
@@ -19,36 +102,175 @@ public:
     Init(InWidth, InHeight, InitialType);
   }
 
-  // 그리드 초기화
+  CoreDungeonGrid(const CoreDungeonGrid &Other) { *this = Other; }
+  CoreDungeonGrid(CoreDungeonGrid &&Other) noexcept {
+    *this = std::move(Other);
+  }
+
+  CoreDungeonGrid &operator=(const CoreDungeonGrid &Other) {
+    if (this == &Other)
+      return *this;
+    CopyFrom(Other);
+    OwnedTypes = Other.OwnedTypes;
+    OwnedRoomIDs = Other.OwnedRoomIDs;
+    OwnedSuitability = Other.OwnedSuitability;
+    OwnedStairTargets = Other.OwnedStairTargets;
+    RebindOwned(Other);
+    return *this;
+  }
+
+  // vector 이동은 버퍼를 그대로 넘기므로 평면 포인터도 유효
+  CoreDungeonGrid &operator=(CoreDungeonGrid &&Other) noexcept {
+    if (this == &Other)
+      return *this;
+    CopyFrom(Other);
+    OwnedTypes = std::move(Other.OwnedTypes);
+    OwnedRoomIDs = std::move(Other.OwnedRoomIDs);
+    OwnedSuitability = std::move(Other.OwnedSuitability);
+    OwnedStairTargets = std::move(Other.OwnedStairTargets);
+    Other.Width = Other.Height = 0;
+    Other.Types = {};
+    Other.RoomIDs = {};
+    Other.Suitability = {};
+    Other.StairTargets = {};
+    return *this;
+  }
+
+  // 외부 타일 구조체 배열 위의 뷰 생성 (Stride = 구조체 크기)
+  // 모든 평면이 할당된 것으로 취급됨. 외부 배열이 살아 있는 동안만 유효
+  static CoreDungeonGrid MakeView(int32_t InWidth, int32_t InHeight,
+                                  size_t Stride, ETileType *TypeData,
+                                  int32_t *RoomIDData, float *SuitabilityData,
+                                  int32_t *StairTargetData) {
+    CoreDungeonGrid View;
+    View.Width = InWidth;
+    View.Height = InHeight;
+    View.Types = {TypeData, Stride};
+    View.RoomIDs = {RoomIDData, Stride};
+    View.Suitability = {SuitabilityData, Stride};
+    View.StairTargets = {StairTargetData, Stride};
+    return View;
+  }
+
+  bool IsView() const {
+    return Types.IsAllocated() && Types.Data != OwnedTypes.data();
+  }
+
+  // 그리드 초기화 (소유 저장소로 전환, 선택 평면은 기본값으로 되돌림)
   void Init(int32_t InWidth, int32_t InHeight,
             ETileType InitialType = ETileType::Wall) {
     Width = InWidth;
     Height = InHeight;
-    Tiles.resize(Width * Height);
-
-    for (int32_t Y = 0; Y < Height; Y++) {
-      for (int32_t X = 0; X < Width; X++) {
-        int32_t Index = Y * Width + X;
-        Tiles[Index].X = X;
-        Tiles[Index].Y = Y;
-        Tiles[Index].Type = InitialType;
-        Tiles[Index].RoomID = -1;
-        Tiles[Index].StairTargetFloor = -1;
-      }
-    }
+    OwnedTypes.assign(Num(), InitialType);
+    OwnedRoomIDs.clear();
+    OwnedSuitability.clear();
+    OwnedStairTargets.clear();
+    Types = {OwnedTypes.data(), sizeof(ETileType)};
+    RoomIDs = {};
+    Suitability = {};
+    StairTargets = {};
+  }
+
+  size_t Num() const { return (size_t)Width * (size_t)Height; }
+  size_t GetIndex(int32_t X, int32_t Y) const {
+    return (size_t)Y * (size_t)Width + (size_t)X;
+  }
+
+  // 타일 접근 (기존 코드 호환용 뷰, 필드 단위 읽기/쓰기)
+  CoreTileRef GetTile(int32_t X, int32_t Y) {
+    const size_t Index = GetIndex(X, Y);
+    const size_t Count = Num();
+    return CoreTileRef{X,
+                       Y,
+                       Types[Index],
+                       {RoomIDs, OwnedRoomIDs, Index, Count, -1},
+                       {Suitability, OwnedSuitability, Index, Count, 0.0f},
+                       {StairTargets, OwnedStairTargets, Index, Count, -1}};
   }
 
-  // 타일 접근 (참조 반환)
-  FCoreTile &GetTile(int32_t X, int32_t Y) { return Tiles[Y * Width + X]; }
+  FCoreTile GetTile(int32_t X, int32_t Y) const {
+    const size_t Index = GetIndex(X, Y);
+    FCoreTile Tile;
+    Tile.X = X;
+    Tile.Y = Y;
+    Tile.Type = Types[Index];
+    Tile.RoomID = GetRoomID(X, Y);
+    Tile.MonsterSuitability = GetSuitability(X, Y);
+    Tile.StairTargetFloor = GetStairTarget(X, Y);
+    return Tile;
+  }
 
-  const FCoreTile &GetTile(int32_t X, int32_t Y) const {
-    return Tiles[Y * Width + X];
+  // 평면 직접 접근 (스캔 위주 알고리즘용)
+  ETileType GetType(int32_t X, int32_t Y) const {
+    return Types[GetIndex(X, Y)];
+  }
+  void SetType(int32_t X, int32_t Y, ETileType Type) {
+    Types[GetIndex(X, Y)] = Type;
+  }
+
+  int32_t GetRoomID(int32_t X, int32_t Y) const {
+    return RoomIDs.IsAllocated() ? RoomIDs[GetIndex(X, Y)] : -1;
+  }
+  float GetSuitability(int32_t X, int32_t Y) const {
+    return Suitability.IsAllocated() ? Suitability[GetIndex(X, Y)] : 0.0f;
+  }
+  int32_t GetStairTarget(int32_t X, int32_t Y) const {
+    return StairTargets.IsAllocated() ? StairTargets[GetIndex(X, Y)] : -1;
+  }
+
+  // 선택 평면을 기본값으로 할당 (전체 평면을 채우는 패스 전에 호출)
+  CoreTilePlane<float> &EnsureSuitabilityPlane() {
+    return EnsurePlane(Suitability, OwnedSuitability, 0.0f);
+  }
+  CoreTilePlane<int32_t> &EnsureRoomIDPlane() {
+    return EnsurePlane(RoomIDs, OwnedRoomIDs, -1);
   }
 
   // 좌표 유효성 검사
   bool IsValid(int32_t X, int32_t Y) const {
     return X >= 0 && X < Width && Y >= 0 && Y < Height;
   }
+
+private:
+  // 소유 저장소 (뷰일 때는 비어 있거나 지연 할당된 선택 평면만 가짐)
+  std::vector<ETileType> OwnedTypes;
+  std::vector<int32_t> OwnedRoomIDs;
+  std::vector<float> OwnedSuitability;
+  std::vector<int32_t> OwnedStairTargets;
+
+  template <typename T>
+  CoreTilePlane<T> &EnsurePlane(CoreTilePlane<T> &Plane,
+                                std::vector<T> &Storage, T Default) {
+    if (!Plane.IsAllocated()) {
+      Storage.assign(Num(), Default);
+      Plane = {Storage.data(), sizeof(T)};
+    }
+    return Plane;
+  }
+
+  void CopyFrom(const CoreDungeonGrid &Other) {
+    Width = Other.Width;
+    Height = Other.Height;
+    Types = Other.Types;
+    RoomIDs = Other.RoomIDs;
+    Suitability = Other.Suitability;
+    StairTargets = Other.StairTargets;
+  }
+
+  // 복사 후 원본의 소유 평면을 가리키던 포인터를 내 저장소로 교체
+  template <typename T>
+  static void Rebind(CoreTilePlane<T> &Plane, const std::vector<T> &Source,
+                     std::vector<T> &Storage) {
+    if (Plane.IsAllocated() && Plane.Data == Source.data())
+      Plane.Data = Storage.data();
+  }
+
+  void RebindOwned(const CoreDungeonGrid &Other) {
+    Rebind(Types, Other.OwnedTypes, OwnedTypes);
+    Rebind(RoomIDs, Other.OwnedRoomIDs, OwnedRoomIDs);
+    Rebind(Suitability, Other.OwnedSuitability, OwnedSuitability);
+    Rebind(StairTargets, Other.OwnedStairTargets, OwnedStairTargets);
+  }
 };
 
 } // namespace DungeonCore
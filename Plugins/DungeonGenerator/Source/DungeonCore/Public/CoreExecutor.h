@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreInterfaces.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace DungeonCore {
+
+// 순차 실행기 (실행기를 주입하지 않았을 때의 기본 동작)
+class CoreSequentialExecutor : public IExecutor {
+public:
+  virtual void ParallelFor(int32_t Count,
+                           const std::function<void(int32_t)> &Body) override {
+    for (int32_t i = 0; i < Count; i++) {
+      Body(i);
+    }
+  }
+};
+
+// std::thread 기반 실행기 (엔진 밖, 예: 서버/벤치마크용)
+// 호출마다 스레드를 만들고 인덱스를 원자 카운터로 나눠 가짐
+class CoreThreadExecutor : public IExecutor {
+public:
+  explicit CoreThreadExecutor(int32_t InMaxThreads = 0)
+      : MaxThreads(InMaxThreads > 0
+                       ? InMaxThreads
+                       : (int32_t)std::max(1u,
+                                           std::thread::hardware_concurrency())) {
+  }
+
+  virtual void ParallelFor(int32_t Count,
+                           const std::function<void(int32_t)> &Body) override {
+    const int32_t NumThreads = std::min(Count, MaxThreads);
+    if (NumThreads <= 1) {
+      for (int32_t i = 0; i < Count; i++) {
+        Body(i);
+      }
+      return;
+    }
+
+    std::atomic<int32_t> NextIndex{0};
+    auto Worker = [&]() {
+      for (int32_t i = NextIndex++; i < Count; i = NextIndex++) {
+        Body(i);
+      }
+    };
+
+    // 호출 스레드도 작업에 참여
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumThreads - 1);
+    for (int32_t t = 1; t < NumThreads; t++) {
+      Threads.emplace_back(Worker);
+    }
+    Worker();
+    for (auto &Thread : Threads) {
+      Thread.join();
+    }
+  }
+
+private:
+  int32_t MaxThreads;
+};
+
+} // namespace DungeonCore
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 
 
@@ -16,6 +18,20 @@ public:
   virtual float GetFraction() = 0; // 0.0 ~ 1.0 사이의 실수 반환
   virtual int32_t RandRange(int32_t Min,
                             int32_t Max) = 0; // Min ~ Max 사이의 정수 반환
+
+  // 같은 구현의 독립 난수 생성기 생성 (병렬 작업마다 하나씩 사용)
+  virtual std::unique_ptr<IRandom> CreateChild(int32_t Seed) const = 0;
+};
+
+// 병렬 실행기 인터페이스 (플랫폼 독립적)
+// 엔진 쪽은 ParallelFor, 서버는 CoreThreadExecutor 등을 주입
+class IExecutor {
+public:
+  virtual ~IExecutor() = default;
+
+  // Body(0) ~ Body(Count - 1)을 실행하고 모두 끝날 때까지 대기
+  virtual void ParallelFor(int32_t Count,
+                           const std::function<void(int32_t)> &Body) = 0;
 };
 
 // 로거 인터페이스 (플랫폼 독립적)
@@ -3,7 +3,6 @@
 #include "CoreDungeonGrid.h"
 #include "CoreInterfaces.h"
 #include "CoreTypes.h"
-#include <map>
 #include <vector>
 
 
@@ -38,23 +37,24 @@ struct CorePropConfig {
 // 핵심 오브젝트 배치 관리자
 class CoreObjectPlacer {
 public:
-  // 몬스터 구역 계산 (공간 해싱 사용)
+  // 몬스터 구역 계산 (바닥 적분 영상 + 원판 띠 분해, O(W x H x 띠 수))
+  // Executor가 있으면 행 묶음 단위로 병렬 처리 (결과는 동일)
   static void CalculateMonsterZones(CoreDungeonGrid &Grid, float CheckRadius,
                                     int32_t MinOpenSpace,
-                                    ILogger *Logger = nullptr);
-
-  // 프롭 생성 (다양성 보장)
+                                    ILogger *Logger = nullptr,
+                                    IExecutor *Executor = nullptr);
+
+  // 프롭 생성 (포아송 디스크, 다양성 보장)
+  // - 모든 바닥 타일을 한 번씩 후보로 시도 (샘플 수가 바닥 면적에 비례)
+  // - MinDistance: 모든 프롭 사이, AvoidSameTypeRadius: 같은 유형끼리 (배경
+  //   격자로 O(1) 검사)
+  // - 그리드를 블록으로 나눠 블록마다 독립 난수 사용, Executor가 있으면 서로
+  //   닿지 않는 블록끼리 병렬 처리 (Executor 유무와 관계없이 같은 결과)
   static std::vector<CorePropData>
   GenerateProps(const CoreDungeonGrid &Grid,
                 const std::vector<CorePropConfig> &Configs, IRandom &Random,
-                bool bEnforceDiversity, ILogger *Logger = nullptr);
-
-private:
-  // 프롭 다양성 체크 (동일 유형이 너무 가까이 있는지 확인)
-  static bool CheckPropDiversity(
-      float X, float Y, ECorePropType Type,
-      const std::map<ECorePropType, std::vector<CorePropData>> &PropsByType,
-      float Radius);
+                bool bEnforceDiversity, ILogger *Logger = nullptr,
+                IExecutor *Executor = nullptr);
 };
 
 } // namespace DungeonCore
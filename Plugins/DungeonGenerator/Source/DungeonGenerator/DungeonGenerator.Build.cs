@@ -18,6 +18,8 @@ public class DungeonGenerator : ModuleRules
         "Engine",
         "Slate",
         "SlateCore",
+        "GeometryCore",           // FTransformSRT3d, index mappings (chunk merge worker)
+        "DynamicMesh"             // FDynamicMeshEditor, weld/simplify (chunk merge worker)
     };
 
     public DungeonGenerator(ReadOnlyTargetRules Target) : base(Target)
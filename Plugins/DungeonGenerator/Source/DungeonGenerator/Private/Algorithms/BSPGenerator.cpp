@@ -2,22 +2,18 @@
 #include "DungeonCoreAdapters.h"
 
 void UBSPGenerator::Generate(FDungeonGrid& Grid, FRandomStream& RandomStream) {
-    // 1. Convert to Core
-    DungeonCore::CoreDungeonGrid CoreGrid = Grid.ToCore();
+    // 1. View Unreal grid as Core (no copy, writes go straight to Grid.Tiles)
+    DungeonCore::CoreDungeonGrid CoreGrid = Grid.ViewAsCore();
 
     // 2. Setup Adapters
     FUnrealRandomAdapter RandomAdapter(RandomStream);
     FUnrealLoggerAdapter LoggerAdapter;
 
-    // 3. Run Core Algorithm
-    DungeonCore::CoreBSPGenerator CoreGen;
+    // 3. Run Core Algorithm (member instance: node arena reused between calls)
     CoreGen.MinNodeSize = MinNodeSize;
     CoreGen.MinRoomSize = MinRoomSize;
     CoreGen.SplitRatio = SplitRatio;
     CoreGen.CorridorWidth = CorridorWidth;
 
     CoreGen.Generate(CoreGrid, RandomAdapter, &LoggerAdapter);
-
-    // 4. Update Unreal Grid
-    Grid.FromCore(CoreGrid);
 }
@@ -1,4 +1,5 @@
 ﻿#include "Algorithms/BSPGenerator.h"
+#include "Async/ParallelFor.h"
 #include "DungeonCoreAdapters.h"
 
 FMultiFloorDungeon UBSPGenerator::GenerateMultiFloor(
@@ -11,29 +12,30 @@ FMultiFloorDungeon UBSPGenerator::GenerateMultiFloor(
 
     UE_LOG(LogTemp, Log, TEXT("GenerateMultiFloor: Starting generation of %d floors"), Config.NumFloors);
 
-    // Step 1: Generate each floor
-    for (int32 FloorIndex = 0; FloorIndex < Config.NumFloors; FloorIndex++) {
+    // Step 1: Generate each floor in parallel
+    // Floors share no state and each has its own derived seed, so the result
+    // is identical to sequential generation for a given seed.
+    ParallelFor(Config.NumFloors, [&](int32 FloorIndex) {
         FDungeonGrid& Floor = MultiFloor.Floors[FloorIndex];
         Floor.Init(Config.Width, Config.Height, ETileType::Wall);
 
         // Create floor-specific random stream
-        FRandomStream FloorRandom(RandomStream.GetInitialSeed() + FloorIndex * 1000);
+        FRandomStream FloorRandom(DungeonCore::CoreBSPGenerator::DeriveFloorSeed(
+            RandomStream.GetInitialSeed(), FloorIndex));
 
         // Setup adapters
         FUnrealRandomAdapter RandomAdapter(FloorRandom);
         FUnrealLoggerAdapter LoggerAdapter;
 
-        // Generate using core BSP
-        DungeonCore::CoreDungeonGrid CoreGrid = Floor.ToCore();
+        // Generate using core BSP (in place, no ToCore/FromCore copies)
+        DungeonCore::CoreDungeonGrid CoreGrid = Floor.ViewAsCore();
         DungeonCore::CoreBSPGenerator CoreGen;
         CoreGen.MinNodeSize = 10;
         CoreGen.MinRoomSize = 6;
         CoreGen.SplitRatio = 0.4f;
         CoreGen.Generate(CoreGrid, RandomAdapter, &LoggerAdapter);
-
-        Floor.FromCore(CoreGrid);
         UE_LOG(LogTemp, Log, TEXT("  Floor %d generated"), FloorIndex + 1);
-    }
+    });
 
     // Step 2: Enforce vertical alignment
     if (Config.bEnforceVerticalAlignment) {
@@ -78,53 +80,72 @@ TArray<FStairPosition> UBSPGenerator::PlaceStairs(
     TArray<FStairPosition> AllStairs;
     const float MinDistSq = Config.MinStairDistance * Config.MinStairDistance;
 
-    for (int32 Floor = 0; Floor < MultiFloor.NumFloors - 1; Floor++) {
-        TArray<FIntPoint> ValidPositions;
-        for (int32 Y = 0; Y < MultiFloor.Floors[Floor].Height; Y++) {
-            for (int32 X = 0; X < MultiFloor.Floors[Floor].Width; X++) {
-                if (MultiFloor.IsFloorTile(Floor, X, Y) && MultiFloor.IsFloorTile(Floor + 1, X, Y)) {
-                    ValidPositions.Add(FIntPoint(X, Y));
-                }
-            }
-        }
+    // Random draws allowed per stair before falling back to a full scan
+    constexpr int32 DrawsPerStair = 32;
 
-        if (ValidPositions.Num() == 0) {
+    TArray<FIntPoint> ValidPositions;
+    for (int32 Floor = 0; Floor < MultiFloor.NumFloors - 1; Floor++) {
+        const int32 Width = MultiFloor.Floors[Floor].Width;
+        const int32 Height = MultiFloor.Floors[Floor].Height;
+        if (Width <= 0 || Height <= 0) {
             continue;
         }
 
-        // Shuffle
-        for (int32 i = ValidPositions.Num() - 1; i > 0; i--) {
-            const int32 j = RandomStream.RandRange(0, i);
-            ValidPositions.Swap(i, j);
-        }
+        // Stairs need floor on both this floor and the one above
+        auto IsValidPosition = [&](int32 X, int32 Y) {
+            return MultiFloor.IsFloorTile(Floor, X, Y) && MultiFloor.IsFloorTile(Floor + 1, X, Y);
+        };
 
+        // Place unless the tile repeats or sits too close to a stair on this floor
+        const int32 FirstStair = AllStairs.Num();
         int32 StairsPlaced = 0;
-        for (const FIntPoint& Pos : ValidPositions) {
-            if (StairsPlaced >= Config.StairsPerFloor) break;
-
-            bool bTooClose = false;
-            for (const FStairPosition& ExistingStair : AllStairs) {
-                if (ExistingStair.FloorIndex == Floor) {
-                    const float DistSq = FVector2D::DistSquared(
-                        FVector2D(Pos.X, Pos.Y),
-                        FVector2D(ExistingStair.X, ExistingStair.Y));
-                    if (DistSq < MinDistSq) {
-                        bTooClose = true;
-                        break;
-                    }
+        auto TryPlaceStair = [&](int32 X, int32 Y) {
+            for (int32 k = FirstStair; k < AllStairs.Num(); k++) {
+                const int32 DX = X - AllStairs[k].X;
+                const int32 DY = Y - AllStairs[k].Y;
+                const int32 DistSq = DX * DX + DY * DY;
+                if (DistSq == 0 || DistSq < MinDistSq) {
+                    return;
                 }
             }
 
-            if (!bTooClose) {
-                FStairPosition Stair;
-                Stair.FloorIndex = Floor;
-                Stair.X = Pos.X;
-                Stair.Y = Pos.Y;
-                Stair.TargetFloor = Floor + 1;
-                AllStairs.Add(Stair);
-                StairsPlaced++;
+            FStairPosition Stair;
+            Stair.FloorIndex = Floor;
+            Stair.X = X;
+            Stair.Y = Y;
+            Stair.TargetFloor = Floor + 1;
+            AllStairs.Add(Stair);
+            StairsPlaced++;
+        };
+
+        // 1. Test random tiles directly; with common floor tiles this
+        // finishes without scanning the grid
+        const int32 MaxDraws = Config.StairsPerFloor * DrawsPerStair;
+        for (int32 Draw = 0; Draw < MaxDraws && StairsPlaced < Config.StairsPerFloor; Draw++) {
+            const int32 X = RandomStream.RandRange(0, Width - 1);
+            const int32 Y = RandomStream.RandRange(0, Height - 1);
+            if (IsValidPosition(X, Y)) {
+                TryPlaceStair(X, Y);
             }
         }
+        if (StairsPlaced >= Config.StairsPerFloor) {
+            continue;
+        }
+
+        // 2. Sparse floors or tight spacing: collect candidates and do a
+        // partial shuffle, drawing only as many as needed
+        ValidPositions.Reset();
+        for (int32 Y = 0; Y < Height; Y++) {
+            for (int32 X = 0; X < Width; X++) {
+                if (IsValidPosition(X, Y)) {
+                    ValidPositions.Add(FIntPoint(X, Y));
+                }
+            }
+        }
+        for (int32 i = 0; i < ValidPositions.Num() && StairsPlaced < Config.StairsPerFloor; i++) {
+            ValidPositions.Swap(i, RandomStream.RandRange(i, ValidPositions.Num() - 1));
+            TryPlaceStair(ValidPositions[i].X, ValidPositions[i].Y);
+        }
     }
 
     return AllStairs;
@@ -1,5 +1,4 @@
 #include "Algorithms/CellularAutomataGenerator.h"
-#include "Containers/Queue.h"
 
 void UCellularAutomataGenerator::Generate(FDungeonGrid &Grid,
                                           FRandomStream &RandomStream) {
@@ -34,9 +33,7 @@ void UCellularAutomataGenerator::Generate(FDungeonGrid &Grid,
 
   // 2. Smooth map over multiple iterations
   const int32 ClampedIterations = FMath::Clamp(SmoothIterations, 1, 20);
-  for (int32 i = 0; i < ClampedIterations; i++) {
-    SmoothMap(Grid);
-  }
+  SmoothMap(Grid, ClampedIterations);
 
   // 3. Connect isolated regions
   ConnectRegions(Grid, RandomStream);
@@ -46,181 +43,296 @@ void UCellularAutomataGenerator::Generate(FDungeonGrid &Grid,
          ClampedIterations);
 }
 
-void UCellularAutomataGenerator::SmoothMap(FDungeonGrid &Grid) {
-  // Pre-allocate array for new tile types
-  TArray<ETileType> NewTypes;
-  NewTypes.SetNum(Grid.Width * Grid.Height);
+void UCellularAutomataGenerator::SmoothMap(FDungeonGrid &Grid,
+                                           int32 Iterations) {
+  const int32 Width = Grid.Width;
+  const int32 Height = Grid.Height;
+  const int32 WordsPerRow = (Width + 63) / 64;
+  const int32 NumWords = WordsPerRow * (Height + 2);
+
+  // Bits past the right edge stay set: out of bounds counts as wall
+  const uint64 EdgeMask =
+      (Width % 64) ? ~((uint64(1) << (Width % 64)) - 1) : uint64(0);
+
+  SmoothFront.SetNumUninitialized(NumWords, EAllowShrinking::No);
+  SmoothBack.SetNumUninitialized(NumWords, EAllowShrinking::No);
+  SmoothTouched.SetNumUninitialized(WordsPerRow * Height, EAllowShrinking::No);
+  FMemory::Memzero(SmoothTouched.GetData(),
+                   SmoothTouched.Num() * sizeof(uint64));
+
+  // Padding rows above and below (all wall)
+  for (uint64 *Buffer : {SmoothFront.GetData(), SmoothBack.GetData()}) {
+    FMemory::Memset(Buffer, 0xFF, WordsPerRow * sizeof(uint64));
+    FMemory::Memset(Buffer + (Height + 1) * WordsPerRow, 0xFF,
+                    WordsPerRow * sizeof(uint64));
+  }
 
-  // Apply cellular automata rules
-  for (int32 Y = 0; Y < Grid.Height; Y++) {
-    for (int32 X = 0; X < Grid.Width; X++) {
-      const int32 WallCount = GetSurroundingWallCount(Grid, X, Y);
-      const int32 Idx = Y * Grid.Width + X;
-
-      // Classic 4-5 rule: more than 4 neighbors = wall, less than 4 = floor
-      if (WallCount > 4) {
-        NewTypes[Idx] = ETileType::Wall;
-      } else if (WallCount < 4) {
-        NewTypes[Idx] = ETileType::Floor;
-      } else {
-        // Exactly 4: keep current state
-        NewTypes[Idx] = Grid.GetTile(X, Y).Type;
+  // Pack wall bits
+  for (int32 Y = 0; Y < Height; Y++) {
+    uint64 *Row = SmoothFront.GetData() + (Y + 1) * WordsPerRow;
+    const FDungeonTile *Tiles = Grid.Tiles.GetData() + Y * Width;
+    for (int32 W = 0; W < WordsPerRow; W++) {
+      const int32 X0 = W * 64;
+      const int32 Count = FMath::Min(64, Width - X0);
+      uint64 Bits = 0;
+      for (int32 B = 0; B < Count; B++) {
+        Bits |= uint64(Tiles[X0 + B].Type == ETileType::Wall) << B;
       }
+      Row[W] = Bits;
     }
+    Row[WordsPerRow - 1] |= EdgeMask;
   }
 
-  // Apply new types to grid
-  for (int32 i = 0; i < NewTypes.Num(); i++) {
-    Grid.Tiles[i].Type = NewTypes[i];
+  for (int32 Iter = 0; Iter < Iterations; Iter++) {
+    for (int32 Y = 0; Y < Height; Y++) {
+      const uint64 *Above = SmoothFront.GetData() + Y * WordsPerRow;
+      const uint64 *Center = Above + WordsPerRow;
+      const uint64 *Below = Center + WordsPerRow;
+      uint64 *Out = SmoothBack.GetData() + (Y + 1) * WordsPerRow;
+      uint64 *Touched = SmoothTouched.GetData() + Y * WordsPerRow;
+
+      for (int32 W = 0; W < WordsPerRow; W++) {
+        // Neighbor at X-1 / X+1 (carry bits across words, wall at edges)
+        auto West = [W](const uint64 *Row) {
+          return (Row[W] << 1) | (W > 0 ? Row[W - 1] >> 63 : 1);
+        };
+        auto East = [W, WordsPerRow](const uint64 *Row) {
+          return (Row[W] >> 1) |
+                 (W < WordsPerRow - 1 ? Row[W + 1] << 63 : uint64(1) << 63);
+        };
+
+        // 4-bit counter per tile (bit-sliced ripple adder)
+        uint64 S0 = 0, S1 = 0, S2 = 0, S3 = 0;
+        auto Add = [&](uint64 V) {
+          const uint64 C0 = S0 & V;
+          S0 ^= V;
+          const uint64 C1 = S1 & C0;
+          S1 ^= C0;
+          const uint64 C2 = S2 & C1;
+          S2 ^= C1;
+          S3 |= C2;
+        };
+        Add(West(Above));
+        Add(Above[W]);
+        Add(East(Above));
+        Add(West(Center));
+        Add(East(Center));
+        Add(West(Below));
+        Add(Below[W]);
+        Add(East(Below));
+
+        // Classic 4-5 rule: more than 4 neighbors = wall, less than 4 =
+        // floor, exactly 4 = keep current state
+        const uint64 MoreThan4 = S3 | (S2 & (S1 | S0));
+        const uint64 Exactly4 = ~S3 & S2 & ~S1 & ~S0;
+        Out[W] = MoreThan4 | (Exactly4 & Center[W]);
+        Touched[W] |= ~Exactly4;
+      }
+      Out[WordsPerRow - 1] |= EdgeMask;
+    }
+    Swap(SmoothFront, SmoothBack);
   }
-}
-
-int32 UCellularAutomataGenerator::GetSurroundingWallCount(
-    const FDungeonGrid &Grid, int32 GridX, int32 GridY) {
-  int32 WallCount = 0;
-
-  // Check 3x3 neighborhood (8 neighbors)
-  for (int32 NeighborY = GridY - 1; NeighborY <= GridY + 1; NeighborY++) {
-    for (int32 NeighborX = GridX - 1; NeighborX <= GridX + 1; NeighborX++) {
-      // Skip center tile
-      if (NeighborX == GridX && NeighborY == GridY)
-        continue;
 
-      // In-bounds check
-      if (NeighborX >= 0 && NeighborX < Grid.Width && NeighborY >= 0 &&
-          NeighborY < Grid.Height) {
-        if (Grid.GetTile(NeighborX, NeighborY).Type == ETileType::Wall) {
-          WallCount++;
-        }
-      } else {
-        // Out of bounds counts as wall (encourages walls at edges)
-        WallCount++;
+  // Apply new types to grid (untouched tiles keep their original type)
+  for (int32 Y = 0; Y < Height; Y++) {
+    const uint64 *Row = SmoothFront.GetData() + (Y + 1) * WordsPerRow;
+    const uint64 *Touched = SmoothTouched.GetData() + Y * WordsPerRow;
+    FDungeonTile *Tiles = Grid.Tiles.GetData() + Y * Width;
+    for (int32 X = 0; X < Width; X++) {
+      const uint64 Bit = uint64(1) << (X & 63);
+      if (Touched[X >> 6] & Bit) {
+        Tiles[X].Type =
+            (Row[X >> 6] & Bit) ? ETileType::Wall : ETileType::Floor;
       }
     }
   }
-
-  return WallCount;
 }
 
+namespace {
+static constexpr int32 RegionDirs[4][2] = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
+
+// Cheapest known link between two regions (tile indices of both endpoints)
+struct FRegionLink {
+  int32 Cost = 0;
+  int32 RegionA = 0;
+  int32 RegionB = 0;
+  int32 TileA = 0;
+  int32 TileB = 0;
+};
+} // namespace
+
 void UCellularAutomataGenerator::ConnectRegions(FDungeonGrid &Grid,
                                                 FRandomStream &RandomStream) {
-  // Find all disconnected floor regions
-  TArray<TArray<FDungeonTile>> Regions = GetRegions(Grid, ETileType::Floor);
+  const int32 Width = Grid.Width;
+  const int32 Height = Grid.Height;
+  const int32 NumTiles = Width * Height;
 
-  if (Regions.Num() <= 1) {
+  // 1. Find all disconnected floor regions
+  const int32 NumRegions = LabelRegions(Grid, ETileType::Floor, RegionLabels);
+
+  if (NumRegions <= 1) {
     UE_LOG(LogTemp, Log,
            TEXT("CellularAutomata: Single region found, no connection needed"));
     return;
   }
 
   UE_LOG(LogTemp, Log, TEXT("CellularAutomata: Connecting %d regions"),
-         Regions.Num());
-
-  // Sort regions by size (largest first) for stability
-  Regions.Sort([](const TArray<FDungeonTile> &A,
-                  const TArray<FDungeonTile> &B) { return A.Num() > B.Num(); });
-
-  // Track connected regions
-  TArray<TArray<FDungeonTile>> ConnectedRegions;
-  ConnectedRegions.Add(Regions[0]); // Start with largest region
-
-  // Connect each isolated region to the nearest connected region
-  for (int32 i = 1; i < Regions.Num(); i++) {
-    const TArray<FDungeonTile> &CurrentRegion = Regions[i];
-
-    // Find nearest connection point
-    float BestDistSq = MAX_FLT;
-    FDungeonTile BestTileA;
-    FDungeonTile BestTileB;
-    bool bFoundConnection = false;
-
-    // Search for closest tiles between current region and any connected region
-    for (const FDungeonTile &TileA : CurrentRegion) {
-      for (const TArray<FDungeonTile> &ConnectedRegion : ConnectedRegions) {
-        for (const FDungeonTile &TileB : ConnectedRegion) {
-          const float DistSq = FVector2D::DistSquared(
-              FVector2D(TileA.X, TileA.Y), FVector2D(TileB.X, TileB.Y));
-          if (DistSq < BestDistSq) {
-            BestDistSq = DistSq;
-            BestTileA = TileA;
-            BestTileB = TileB;
-            bFoundConnection = true;
-          }
+         NumRegions);
+
+  // 2. Multi-source BFS from every region tile through the walls. Each tile
+  // ends up owned by its nearest region, remembering the floor tile it grew
+  // from. Where two owners meet, the two sources form a candidate link.
+  RegionOwner = RegionLabels;
+  RegionSource.SetNumUninitialized(NumTiles, EAllowShrinking::No);
+  RegionDistance.SetNumUninitialized(NumTiles, EAllowShrinking::No);
+  RegionQueue.Reset(NumTiles);
+
+  for (int32 Idx = 0; Idx < NumTiles; Idx++) {
+    if (RegionLabels[Idx] != INDEX_NONE) {
+      RegionSource[Idx] = Idx;
+      RegionDistance[Idx] = 0;
+      RegionQueue.Add(Idx);
+    }
+  }
+
+  TMap<uint64, FRegionLink> BestLinks;
+  for (int32 Head = 0; Head < RegionQueue.Num(); Head++) {
+    const int32 Idx = RegionQueue[Head];
+    const int32 X = Idx % Width;
+    const int32 Y = Idx / Width;
+    const int32 Owner = RegionOwner[Idx];
+
+    for (const auto &Dir : RegionDirs) {
+      const int32 NX = X + Dir[0];
+      const int32 NY = Y + Dir[1];
+      if (!Grid.IsValid(NX, NY)) {
+        continue;
+      }
+
+      const int32 NIdx = NY * Width + NX;
+      const int32 NeighborOwner = RegionOwner[NIdx];
+      if (NeighborOwner == INDEX_NONE) {
+        RegionOwner[NIdx] = Owner;
+        RegionSource[NIdx] = RegionSource[Idx];
+        RegionDistance[NIdx] = RegionDistance[Idx] + 1;
+        RegionQueue.Add(NIdx);
+      } else if (NeighborOwner != Owner) {
+        const bool bOwnerFirst = Owner < NeighborOwner;
+        FRegionLink Link;
+        Link.Cost = RegionDistance[Idx] + RegionDistance[NIdx] + 1;
+        Link.RegionA = bOwnerFirst ? Owner : NeighborOwner;
+        Link.RegionB = bOwnerFirst ? NeighborOwner : Owner;
+        Link.TileA = RegionSource[bOwnerFirst ? Idx : NIdx];
+        Link.TileB = RegionSource[bOwnerFirst ? NIdx : Idx];
+
+        const uint64 Key = (uint64(Link.RegionA) << 32) | uint32(Link.RegionB);
+        FRegionLink *Existing = BestLinks.Find(Key);
+        if (!Existing) {
+          BestLinks.Add(Key, Link);
+        } else if (Link.Cost < Existing->Cost) {
+          *Existing = Link;
         }
       }
     }
+  }
 
-    // Create passage between regions
-    if (bFoundConnection) {
-      CreatePassage(Grid, BestTileA, BestTileB);
-      ConnectedRegions.Add(CurrentRegion);
-    } else {
-      UE_LOG(LogTemp, Warning,
-             TEXT("CellularAutomata: Could not connect region %d"), i);
+  // 3. Kruskal: cheapest links first, union-find skips redundant ones
+  TArray<FRegionLink> Links;
+  BestLinks.GenerateValueArray(Links);
+  Links.Sort([](const FRegionLink &A, const FRegionLink &B) {
+    if (A.Cost != B.Cost) {
+      return A.Cost < B.Cost;
     }
+    return A.RegionA != B.RegionA ? A.RegionA < B.RegionA
+                                  : A.RegionB < B.RegionB;
+  });
+
+  TArray<int32> Parent;
+  Parent.SetNumUninitialized(NumRegions);
+  for (int32 i = 0; i < NumRegions; i++) {
+    Parent[i] = i;
   }
-}
-
-TArray<TArray<FDungeonTile>>
-UCellularAutomataGenerator::GetRegions(const FDungeonGrid &Grid,
-                                       ETileType TileType) {
-  TArray<TArray<FDungeonTile>> Regions;
-  TSet<int32> Visited;
+  auto FindRoot = [&Parent](int32 Region) {
+    while (Parent[Region] != Region) {
+      Parent[Region] = Parent[Parent[Region]];
+      Region = Parent[Region];
+    }
+    return Region;
+  };
+
+  int32 NumPassages = 0;
+  for (const FRegionLink &Link : Links) {
+    const int32 RootA = FindRoot(Link.RegionA);
+    const int32 RootB = FindRoot(Link.RegionB);
+    if (RootA == RootB) {
+      continue;
+    }
+    Parent[RootA] = RootB;
 
-  // Flood-fill to identify distinct regions
-  for (int32 Y = 0; Y < Grid.Height; Y++) {
-    for (int32 X = 0; X < Grid.Width; X++) {
-      const int32 Idx = Y * Grid.Width + X;
-      if (!Visited.Contains(Idx) && Grid.GetTile(X, Y).Type == TileType) {
-        TArray<FDungeonTile> NewRegion =
-            GetRegionTiles(Grid, X, Y, TileType, Visited);
-        if (NewRegion.Num() > 0) {
-          Regions.Add(NewRegion);
-        }
-      }
+    CreatePassage(Grid, FIntPoint(Link.TileA % Width, Link.TileA / Width),
+                  FIntPoint(Link.TileB % Width, Link.TileB / Width));
+    if (++NumPassages == NumRegions - 1) {
+      break;
     }
   }
 
-  return Regions;
+  if (NumPassages < NumRegions - 1) {
+    UE_LOG(LogTemp, Warning,
+           TEXT("CellularAutomata: Could not connect %d regions"),
+           NumRegions - 1 - NumPassages);
+  }
 }
 
-TArray<FDungeonTile> UCellularAutomataGenerator::GetRegionTiles(
-    const FDungeonGrid &Grid, int32 StartX, int32 StartY, ETileType TileType,
-    TSet<int32> &Visited) {
-  TArray<FDungeonTile> Tiles;
-  TQueue<FIntPoint> Queue;
-
-  // BFS starting from seed point
-  Queue.Enqueue(FIntPoint(StartX, StartY));
-  Visited.Add(StartY * Grid.Width + StartX);
-
-  static constexpr int32 Dirs[4][2] = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
-
-  while (!Queue.IsEmpty()) {
-    FIntPoint Point;
-    Queue.Dequeue(Point);
-    Tiles.Add(Grid.GetTile(Point.X, Point.Y));
-
-    // Check 4-connected neighbors
-    for (const auto &Dir : Dirs) {
-      const int32 NX = Point.X + Dir[0];
-      const int32 NY = Point.Y + Dir[1];
-      const int32 NIdx = NY * Grid.Width + NX;
-
-      if (Grid.IsValid(NX, NY) && !Visited.Contains(NIdx) &&
-          Grid.GetTile(NX, NY).Type == TileType) {
-        Visited.Add(NIdx);
-        Queue.Enqueue(FIntPoint(NX, NY));
+int32 UCellularAutomataGenerator::LabelRegions(const FDungeonGrid &Grid,
+                                               ETileType TileType,
+                                               TArray<int32> &OutLabels) {
+  const int32 Width = Grid.Width;
+  const int32 NumTiles = Width * Grid.Height;
+
+  OutLabels.Init(INDEX_NONE, NumTiles);
+  RegionQueue.Reset(NumTiles);
+
+  int32 NumRegions = 0;
+  for (int32 StartIdx = 0; StartIdx < NumTiles; StartIdx++) {
+    if (OutLabels[StartIdx] != INDEX_NONE ||
+        Grid.Tiles[StartIdx].Type != TileType) {
+      continue;
+    }
+
+    // BFS flood fill from seed tile
+    const int32 Label = NumRegions++;
+    OutLabels[StartIdx] = Label;
+    RegionQueue.Reset();
+    RegionQueue.Add(StartIdx);
+
+    for (int32 Head = 0; Head < RegionQueue.Num(); Head++) {
+      const int32 Idx = RegionQueue[Head];
+      const int32 X = Idx % Width;
+      const int32 Y = Idx / Width;
+
+      for (const auto &Dir : RegionDirs) {
+        const int32 NX = X + Dir[0];
+        const int32 NY = Y + Dir[1];
+        if (!Grid.IsValid(NX, NY)) {
+          continue;
+        }
+
+        const int32 NIdx = NY * Width + NX;
+        if (OutLabels[NIdx] == INDEX_NONE &&
+            Grid.Tiles[NIdx].Type == TileType) {
+          OutLabels[NIdx] = Label;
+          RegionQueue.Add(NIdx);
+        }
       }
     }
   }
 
-  return Tiles;
+  return NumRegions;
 }
 
 void UCellularAutomataGenerator::CreatePassage(FDungeonGrid &Grid,
-                                               const FDungeonTile &TileA,
-                                               const FDungeonTile &TileB) {
+                                               const FIntPoint &TileA,
+                                               const FIntPoint &TileB) {
   // Bresenham's line algorithm for straight passages
   int32 X = TileA.X;
   int32 Y = TileA.Y;
@@ -1,6 +1,41 @@
 #include "Algorithms/PresetAssemblyGenerator.h"
+#include "Async/ParallelFor.h"
 #include "DungeonGenerator/Public/DungeonLevelGenerator.h"
 
+namespace {
+// [FirstBit, LastBit] 범위 중 워드 Word에 해당하는 마스크
+FORCEINLINE uint64 RangeMaskInWord(int32 Word, int32 FirstBit, int32 LastBit) {
+  const int32 Lo = FMath::Max(FirstBit - Word * 64, 0);
+  const int32 Hi = FMath::Min(LastBit - Word * 64, 63);
+  const uint64 UpToHi = Hi == 63 ? ~uint64(0) : (uint64(1) << (Hi + 1)) - 1;
+  return UpToHi & ~((uint64(1) << Lo) - 1);
+}
+
+// 후보별 시드 (CoreObjectPlacer 블록 시드와 같은 방식)
+int32 DeriveCandidateSeed(int32 BaseSeed, int32 CandidateIndex) {
+  return (int32)((uint32)BaseSeed ^ ((uint32)CandidateIndex * 0x9E3779B1u));
+}
+} // namespace
+
+void FPresetAssemblyState::Reset(int32 Width, int32 Height) {
+  Grid.Init(Width, Height, ETileType::Wall);
+  PlacedModules.Reset();
+  OpenSockets.Reset();
+  DeadSockets.Reset();
+
+  OccupancyWordsPerRow = (FMath::Max(Width, 0) + 63) / 64;
+  Occupancy.Reset();
+  Occupancy.SetNumZeroed(OccupancyWordsPerRow * FMath::Max(Height, 0));
+
+  const int32 CoarseWidth =
+      (FMath::Max(Width, 0) + BroadphaseCellSize - 1) >> BroadphaseShift;
+  const int32 CoarseHeight =
+      (FMath::Max(Height, 0) + BroadphaseCellSize - 1) >> BroadphaseShift;
+  CoarseWordsPerRow = (CoarseWidth + 63) / 64;
+  CoarseOccupancy.Reset();
+  CoarseOccupancy.SetNumZeroed(CoarseWordsPerRow * CoarseHeight);
+}
+
 void UPresetAssemblyGenerator::Generate(FDungeonGrid &Grid,
                                         FRandomStream &Stream) {
   if (!ModuleDatabase) {
@@ -9,83 +44,193 @@ void UPresetAssemblyGenerator::Generate(FDungeonGrid &Grid,
     return;
   }
 
+  const int32 NumCandidates = FMath::Max(CandidateCount, 1);
   UE_LOG(LogTemp, Log,
-         TEXT("PresetAssemblyGenerator: Starting generation... MaxRooms=%d"),
-         MaxRoomCount);
+         TEXT("PresetAssemblyGenerator: Starting generation... MaxRooms=%d, "
+              "Candidates=%d"),
+         MaxRoomCount, NumCandidates);
 
-  // 1. 초기화
+  // 1. 초기화 (스레드를 띄우기 전에 DB 런타임 데이터 준비, 이후 읽기만)
   Grid.Init(Grid.Width, Grid.Height, ETileType::Wall);
   PlacedModules.Empty();
+  LastScore = FPresetLayoutScore();
+  ModuleDatabase->EnsureRuntimeData();
+
+  // 2. 후보별 독립 조립. 후보가 하나면 호출자 스트림을 그대로 사용 (기존
+  // 결과 유지), 여럿이면 스트림에서 뽑은 기준 시드로 파생 시드를 만들어
+  // 스레드 수와 무관하게 같은 결과
+  TArray<FPresetAssemblyState> States;
+  States.SetNum(NumCandidates);
+  TArray<FPresetLayoutScore> Scores;
+  Scores.SetNum(NumCandidates);
+  TArray<bool> Succeeded;
+  Succeeded.Init(false, NumCandidates);
+
+  if (NumCandidates == 1) {
+    States[0].Reset(Grid.Width, Grid.Height);
+    Succeeded[0] = RunAttempt(States[0], Stream);
+    Scores[0] = ScoreLayout(States[0]);
+  } else {
+    const int32 BaseSeed = Stream.RandRange(0, 0x3FFFFFFF);
+    ParallelFor(NumCandidates, [&](int32 CandidateIndex) {
+      FPresetAssemblyState &State = States[CandidateIndex];
+      State.Reset(Grid.Width, Grid.Height);
+      FRandomStream CandidateStream(
+          DeriveCandidateSeed(BaseSeed, CandidateIndex));
+      Succeeded[CandidateIndex] = RunAttempt(State, CandidateStream);
+      Scores[CandidateIndex] = ScoreLayout(State);
+    });
+  }
 
-  // 확장 대기열 (Open List)
-  TArray<FOpenSocketInfo> OpenSockets;
+  // 3. 최고 점수 후보 선택 (동점이면 앞 번호, 실행 순서와 무관)
+  int32 Best = INDEX_NONE;
+  for (int32 i = 0; i < NumCandidates; i++) {
+    if (Succeeded[i] &&
+        (Best == INDEX_NONE || Scores[i].Total > Scores[Best].Total)) {
+      Best = i;
+    }
+  }
 
-  // 2. 루트(Start) 모듈 배치
-  if (!PlaceStartModule(Grid, Stream, OpenSockets)) {
+  if (Best == INDEX_NONE) {
     UE_LOG(LogTemp, Error,
            TEXT("PresetAssemblyGenerator: Failed to place Start Module! Check "
                 "if 'Start' type modules exist in DB."));
     return;
   }
 
-  // 3. 확장 루프 (Growing Tree)
-  int32 CurrentRoomCount = 1;
+  Grid = MoveTemp(States[Best].Grid);
+  PlacedModules = MoveTemp(States[Best].PlacedModules);
+  LastScore = Scores[Best];
+
+  UE_LOG(LogTemp, Log,
+         TEXT("PresetAssemblyGenerator: Complete. Candidate %d/%d, Modules: "
+              "%d, CriticalPath: %d, Branch: %.2f, DeadEnds: %.2f, Score: "
+              "%.3f"),
+         Best + 1, NumCandidates, LastScore.ModuleCount,
+         LastScore.CriticalPathLength, LastScore.BranchFactor,
+         LastScore.DeadEndRatio, LastScore.Total);
+}
+
+bool UPresetAssemblyGenerator::RunAttempt(FPresetAssemblyState &State,
+                                          FRandomStream &Stream) const {
+  // 루트(Start) 모듈 배치
+  if (!PlaceStartModule(State, Stream)) {
+    return false;
+  }
+
+  // 확장 루프 (Growing Tree)
   int32 Attempts = 0;
+  int32 BacktrackSteps = 0;
   const int32 MaxAttempts = MaxRoomCount * 20; // 충분한 시도 횟수 부여
 
-  while (OpenSockets.Num() > 0 && CurrentRoomCount < MaxRoomCount &&
-         Attempts < MaxAttempts) {
+  // 되돌리기 후 다시 막히면 모듈 수가 줄어든 채 끝날 수 있으므로 막힐
+  // 때마다 가장 큰 배치를 보관 (첫 막힘 = 되돌리기 없는 결과)
+  FDungeonGrid BestGrid;
+  TArray<FPlacedModule> BestModules;
+
+  while (State.PlacedModules.Num() < MaxRoomCount && Attempts < MaxAttempts) {
+    if (State.OpenSockets.Num() == 0) {
+      // 모든 소켓이 막혀 확장이 멈춤: 제한 횟수 안에서 마지막 모듈을
+      // 되돌리고 다른 후보로 다시 시도
+      if (BacktrackSteps >= MaxBacktrackSteps) {
+        break;
+      }
+      if (State.PlacedModules.Num() > BestModules.Num()) {
+        BestGrid = State.Grid;
+        BestModules = State.PlacedModules;
+      }
+      if (!BacktrackLastModule(State)) {
+        break;
+      }
+      BacktrackSteps++;
+      continue;
+    }
     Attempts++;
 
     // 전략: 랜덤 선택 (Prim's Algorithm 스타일로 하면 중앙 집중되고,
     // 최신것(DFS)으로 하면 길게 뻗음) 여기서는 완전 랜덤 선택으로 다양한 모양
     // 유도
-    int32 SocketIndex = Stream.RandRange(0, OpenSockets.Num() - 1);
-    FOpenSocketInfo TargetSocket = OpenSockets[SocketIndex];
-
-    // 시도 후에는 성공하든 실패하든 일단 리스트에서 제거 (실패면 막다른 길
-    // 처리하거나 그냥 벽으로 둠) 단, 실패 시 다른 모듈을 시도해볼 수 있도록
-    // 로직을 짤 수도 있지만, 단순화를 위해 Pop. 더 나은 품질을 위해선 'Retry'
-    // 로직이 필요. 여기서는 TryPlaceNextModule이 내부적으로 여러 후보를 시도함.
-    OpenSockets.RemoveAt(SocketIndex);
-
-    TArray<FOpenSocketInfo> NewSockets;
-    if (TryPlaceNextModule(Grid, Stream, TargetSocket, NewSockets)) {
-      OpenSockets.Append(NewSockets);
-      CurrentRoomCount++;
-    } else {
-      // 배치 실패!
+    //
+    // 시도 후에는 성공하든 실패하든 일단 리스트에서 제거. TryPlaceNextModule이
+    // 내부적으로 여러 후보를 시도함.
+    const FOpenSocketInfo TargetSocket = State.OpenSockets.PopRandom(Stream);
+
+    if (!TryPlaceNextModule(State, Stream, TargetSocket)) {
+      // 배치 실패: 되돌리기로 공간이 생길 때를 위해 보관
       // TODO: 해당 소켓 위치를 'DeadEnd' (EndCap) 모듈로 막아야 함.
       // 일단은 그냥 뚫린 채로(Grid상으론 Wall 인접) 둠.
-      // (V2에서 EndCap 로직 추가 가능)
+      State.DeadSockets.Add(TargetSocket);
     }
   }
 
-  UE_LOG(
-      LogTemp, Log,
-      TEXT("PresetAssemblyGenerator: Complete. Rooms: %d, Placed Modules: %d"),
-      CurrentRoomCount, PlacedModules.Num());
+  // 결과로는 Grid/PlacedModules만 쓰므로 나머지 상태는 맞추지 않음
+  if (BestModules.Num() > State.PlacedModules.Num()) {
+    State.Grid = MoveTemp(BestGrid);
+    State.PlacedModules = MoveTemp(BestModules);
+  }
+
+  return true;
+}
+
+FPresetLayoutScore
+UPresetAssemblyGenerator::ScoreLayout(const FPresetAssemblyState &State) const {
+  FPresetLayoutScore Score;
+  Score.ModuleCount = State.PlacedModules.Num();
+  if (Score.ModuleCount == 0) {
+    return Score;
+  }
+
+  int32 Parents = 0;
+  int32 Children = 0;
+  int32 DeadEnds = 0;
+  for (int32 i = 0; i < State.PlacedModules.Num(); i++) {
+    const FPlacedModule &Placed = State.PlacedModules[i];
+    Score.CriticalPathLength =
+        FMath::Max(Score.CriticalPathLength, Placed.Depth);
+    if (Placed.ChildCount > 0) {
+      Parents++;
+      Children += Placed.ChildCount;
+    } else if (i > 0) {
+      DeadEnds++;
+    }
+  }
+  Score.BranchFactor = Parents > 0 ? (float)Children / Parents : 0.0f;
+  Score.DeadEndRatio =
+      Score.ModuleCount > 1 ? (float)DeadEnds / (Score.ModuleCount - 1) : 0.0f;
+
+  // 모듈 수/경로 길이는 목표 방 수로 정규화, 분기는 2갈래 이상부터 가점
+  const float Target = (float)FMath::Max(MaxRoomCount, 1);
+  const float ExtraBranches = FMath::Max(Score.BranchFactor - 1.0f, 0.0f);
+  Score.Total = ScoreWeightModules * (Score.ModuleCount / Target) +
+                ScoreWeightCriticalPath * (Score.CriticalPathLength / Target) +
+                ScoreWeightBranching * ExtraBranches -
+                ScoreWeightDeadEnds * Score.DeadEndRatio;
+  return Score;
 }
 
-bool UPresetAssemblyGenerator::PlaceStartModule(
-    FDungeonGrid &Grid, FRandomStream &Stream,
-    TArray<FOpenSocketInfo> &OutOpenSockets) {
+bool UPresetAssemblyGenerator::PlaceStartModule(FPresetAssemblyState &State,
+                                                FRandomStream &Stream) const {
   // DB에서 Start 타입 찾기
-  TArray<FModuleData> StartModules =
-      ModuleDatabase->GetModulesByType(EDungeonPresetModuleType::Start);
+  TArray<int32, TInlineAllocator<8>> StartModules;
+  for (int32 i = 0; i < ModuleDatabase->Modules.Num(); i++) {
+    if (ModuleDatabase->Modules[i].Type == EDungeonPresetModuleType::Start) {
+      StartModules.Add(i);
+    }
+  }
   if (StartModules.Num() == 0)
     return false;
 
   // 랜덤 선택
-  const FModuleData &SelectedModule =
+  const int32 SelectedIndex =
       StartModules[Stream.RandRange(0, StartModules.Num() - 1)];
+  const FModuleData &SelectedModule = ModuleDatabase->Modules[SelectedIndex];
 
   // 그리드 중앙에 배치
-  FIntPoint CenterPos(Grid.Width / 2 - SelectedModule.Size.X / 2,
-                      Grid.Height / 2 - SelectedModule.Size.Y / 2);
+  FIntPoint CenterPos(State.Grid.Width / 2 - SelectedModule.Size.X / 2,
+                      State.Grid.Height / 2 - SelectedModule.Size.Y / 2);
 
-  if (CanPlaceModule(Grid, SelectedModule, CenterPos)) {
-    StampModuleToGrid(Grid, SelectedModule, CenterPos, OutOpenSockets);
+  if (CanPlaceModule(State, SelectedModule, CenterPos)) {
+    StampModuleToGrid(State, SelectedIndex, CenterPos);
     return true;
   }
 
@@ -93,94 +238,50 @@ bool UPresetAssemblyGenerator::PlaceStartModule(
 }
 
 bool UPresetAssemblyGenerator::TryPlaceNextModule(
-    FDungeonGrid &Grid, FRandomStream &Stream,
-    const FOpenSocketInfo &TargetSocket,
-    TArray<FOpenSocketInfo> &OutOpenSockets) {
-  // 1. 매칭 조건 설정
-  // 반대 방향이어야 함 (North -> South)
-  EModuleSocketDirection RequiredDir =
-      GetOppositeDirection(TargetSocket.SocketData.Direction);
-  FName RequiredTag =
-      TargetSocket.SocketData.SocketTag; // 태그 매칭 (일단 동일 태그)
-
-  // 2. 후보군 검색
-  // 모든 모듈을 뒤져서 조건에 맞는 '소켓'을 가진 모듈 찾기
-  struct FCandidate {
-    const FModuleData *Module;
-    int32 SocketIndex;
-  };
-  TArray<FCandidate> Candidates;
+    FPresetAssemblyState &State, FRandomStream &Stream,
+    const FOpenSocketInfo &TargetSocket) const {
+  // 1. 후보군 조회 (방향 + 태그로 미리 만든 인덱스, 원점 오프셋 포함)
+  const FModuleSocketBucket &Bucket = ModuleDatabase->FindSocketMatches(
+      TargetSocket.SocketData.Direction, TargetSocket.SocketData.SocketTag);
 
-  for (const FModuleData &Module : ModuleDatabase->Modules) {
-    // Start 모듈은 다시 나오지 않도록 제외 (선택 사항)
-    if (Module.Type == EDungeonPresetModuleType::Start)
-      continue;
+  if (Bucket.Matches.Num() == 0)
+    return false;
 
-    for (int32 i = 0; i < Module.Sockets.Num(); i++) {
-      const FModuleSocket &Socket = Module.Sockets[i];
-
-      // 방향 체크
-      if (Socket.Direction == RequiredDir) {
-        // 태그 체크 (둘 중 하나가 None이면 호환, 아니면 같아야 함)
-        bool bTagMatch = (RequiredTag.IsNone() || Socket.SocketTag.IsNone() ||
-                          RequiredTag == Socket.SocketTag);
-        if (bTagMatch) {
-          Candidates.Add({&Module, i});
-        }
-      }
+  // 2. 가중치 비복원 추출 순서로 배치 시도: 후보마다 키 u^(1/w)를 한 번만
+  // 뽑고 (로그로 ln(u)/w), 키가 큰 순서가 곧 추출 순서. 대부분 앞쪽 몇 개에서
+  // 성공하므로 전체 정렬 대신 힙에서 하나씩 꺼냄. 되돌리기로 제외된 모듈은 뺌
+  using FCandidateKey = FPresetAssemblyState::FCandidateKey;
+  TArray<FCandidateKey> &Candidates = State.CandidateScratch;
+  Candidates.Reset(Bucket.Matches.Num());
+  for (int32 i = 0; i < Bucket.Matches.Num(); i++) {
+    const FModuleSocketMatch &Match = Bucket.Matches[i];
+    if (Match.ModuleIndex == TargetSocket.ExcludedModuleIndex) {
+      continue;
     }
+    // 1 - FRand() 는 (0, 1] 이므로 로그가 유한함. 가중치는 항상 양수
+    // (BuildRuntimeData에서 0 이하 모듈 제외)
+    const float Key = FMath::Loge(1.0f - Stream.FRand()) / Match.Weight;
+    Candidates.Add({Key, i});
   }
 
-  if (Candidates.Num() == 0)
-    return false;
-
-  // 3. 셔플 (랜덤성)
-  // Fisher-Yates Shuffle
-  for (int32 i = Candidates.Num() - 1; i > 0; i--) {
-    int32 j = Stream.RandRange(0, i);
-    Candidates.Swap(i, j);
-  }
+  const auto KeyOrder = [](const FCandidateKey &A, const FCandidateKey &B) {
+    return A.Key > B.Key;
+  };
+  Candidates.Heapify(KeyOrder);
 
-  // 4. 배치 시도
-  for (const FCandidate &Cand : Candidates) {
-    const FModuleData *Mod = Cand.Module;
-    const FModuleSocket &CandSocket = Mod->Sockets[Cand.SocketIndex];
-
-    // 위치 계산
-    // 공식: TargetWorldPos + WalkVector - CandidateLocalPos = NewOrigin
-    // 1) Target Socket에서 **한 칸 전진**하여 '새로운 모듈의 소켓 위치'를 구함
-    FIntPoint ConnectionWorldPos =
-        TargetSocket.WorldPosition +
-        GetDirectionOffset(TargetSocket.SocketData.Direction);
-
-    // 2) 그 위치가 새 모듈의 소켓(CandSocket) 위치가 되도록 원점 역산
-    // ConnectionWorldPos = NewOrigin + CandSocket.LocalPosition
-    // 따라서 NewOrigin = ConnectionWorldPos - CandSocket.LocalPosition
-    FIntPoint NewOrigin = ConnectionWorldPos - CandSocket.LocalPosition;
-
-    if (CanPlaceModule(Grid, *Mod, NewOrigin)) {
-      // 배치 성공!
-      StampModuleToGrid(Grid, *Mod, NewOrigin, OutOpenSockets);
-
-      // 주의: 방금 연결된 소켓(Cand.SocketIndex)은 OpenSockets에 들어가면 안
-      // 됨. StampModuleToGrid 내부에서 처리하거나, 반환된 후 제거해야 함. 현재
-      // StampModuleToGrid 구현 상 모든 소켓을 반환하므로, 여기서 연결된 소켓을
-      // 찾아 제거.
-
-      // 연결된 소켓 찾아서 제거 (로컬 위치가 CandSocket의 로컬 위치와 같은 것)
-      for (int32 k = 0; k < OutOpenSockets.Num(); k++) {
-        if (OutOpenSockets[k].SocketData.LocalPosition ==
-            CandSocket.LocalPosition) {
-          OutOpenSockets.RemoveAt(k);
-          break;
-        }
-      }
+  while (Candidates.Num() > 0) {
+    FCandidateKey Top;
+    Candidates.HeapPop(Top, KeyOrder, EAllowShrinking::No);
+    const FModuleSocketMatch &Match = Bucket.Matches[Top.MatchIndex];
 
-      // 로그
-      // UE_LOG(LogTemp, Log, TEXT("Connected %s to %s"),
-      // *Mod->ModuleID.ToString(),
-      // *TargetSocket.SocketData.SocketTag.ToString());
+    // 새 원점 = 대상 소켓 + (한 칸 전진 - 후보 소켓 로컬 위치)
+    const FModuleData &Mod = ModuleDatabase->Modules[Match.ModuleIndex];
+    const FIntPoint NewOrigin = TargetSocket.WorldPosition + Match.OriginOffset;
 
+    if (CanPlaceModule(State, Mod, NewOrigin)) {
+      // 배치 성공! 방금 연결된 소켓은 대기열에 넣지 않음
+      StampModuleToGrid(State, Match.ModuleIndex, NewOrigin, &TargetSocket,
+                        Match.SocketIndex);
       return true;
     }
   }
@@ -188,25 +289,64 @@ bool UPresetAssemblyGenerator::TryPlaceNextModule(
   return false;
 }
 
-bool UPresetAssemblyGenerator::CanPlaceModule(const FDungeonGrid &Grid,
-                                              const FModuleData &Module,
-                                              FIntPoint Position) {
+bool UPresetAssemblyGenerator::CanPlaceModule(
+    const FPresetAssemblyState &State, const FModuleData &Module,
+    FIntPoint Position) const {
+  const FDungeonGrid &Grid = State.Grid;
+  constexpr int32 BroadphaseShift = FPresetAssemblyState::BroadphaseShift;
+
   // 범위 검사
   if (Position.X < 0 || Position.Y < 0 ||
       Position.X + Module.Size.X > Grid.Width ||
       Position.Y + Module.Size.Y > Grid.Height) {
     return false;
   }
+  if (!Module.HasFootprint()) {
+    return false;
+  }
 
-  // 겹침 검사
-  for (int32 Y = 0; Y < Module.Size.Y; Y++) {
-    for (int32 X = 0; X < Module.Size.X; X++) {
-      // 모듈 내부가 '꽉 찬' 공간이라고 가정 (직사각형)
-      // 실제 데이터가 복잡하면 Layout 텍스처 등을 참조해야 함
+  // 1. 광역 판정: AABB가 덮는 거친 블록이 전부 비어 있으면 바로 통과
+  // (이미 배치된 모듈과 멀리 떨어진 후보 대부분이 여기서 끝남)
+  const int32 CX0 = Position.X >> BroadphaseShift;
+  const int32 CX1 = (Position.X + Module.Size.X - 1) >> BroadphaseShift;
+  const int32 CY0 = Position.Y >> BroadphaseShift;
+  const int32 CY1 = (Position.Y + Module.Size.Y - 1) >> BroadphaseShift;
+  bool bNearOccupied = false;
+  for (int32 CY = CY0; CY <= CY1 && !bNearOccupied; CY++) {
+    const uint64 *Row =
+        State.CoarseOccupancy.GetData() + CY * State.CoarseWordsPerRow;
+    for (int32 W = CX0 >> 6; W <= CX1 >> 6; W++) {
+      if (Row[W] & RangeMaskInWord(W, CX0, CX1)) {
+        bNearOccupied = true;
+        break;
+      }
+    }
+  }
+  if (!bNearOccupied) {
+    return true;
+  }
 
-      // Grid에서 Wall이 아니면 이미 점유된 것
-      if (Grid.GetTile(Position.X + X, Position.Y + Y).Type !=
-          ETileType::Wall) {
+  // 2. 정밀 판정: 모듈 행 마스크를 Position.X만큼 밀어 점유 행과 AND
+  // (빈 칸(VoidTiles)에는 다른 모듈이 끼어들 수 있음)
+  const int32 WordOffset = Position.X >> 6;
+  const int32 Shift = Position.X & 63;
+  for (int32 Y = 0; Y < Module.Size.Y; Y++) {
+    const uint64 *Occ = State.Occupancy.GetData() +
+                        (Position.Y + Y) * State.OccupancyWordsPerRow;
+    const uint64 *Foot =
+        Module.FootprintRows.GetData() + Y * Module.FootprintWordsPerRow;
+    for (int32 W = 0; W < Module.FootprintWordsPerRow; W++) {
+      const uint64 Bits = Foot[W];
+      if (Bits == 0) {
+        continue;
+      }
+      const int32 Target = WordOffset + W;
+      if (Occ[Target] & (Bits << Shift)) {
+        return false;
+      }
+      // 워드 경계를 넘는 상위 비트 (범위 검사로 Target + 1은 유효할 때만 접근)
+      if (Shift != 0 && (Bits >> (64 - Shift)) != 0 &&
+          (Occ[Target + 1] & (Bits >> (64 - Shift)))) {
         return false;
       }
     }
@@ -215,58 +355,128 @@ bool UPresetAssemblyGenerator::CanPlaceModule(const FDungeonGrid &Grid,
 }
 
 void UPresetAssemblyGenerator::StampModuleToGrid(
-    FDungeonGrid &Grid, const FModuleData &Module, FIntPoint Position,
-    TArray<FOpenSocketInfo> &OutNewSockets) {
-  // 1. 그리드 업데이트
+    FPresetAssemblyState &State, int32 ModuleIndex, FIntPoint Position,
+    const FOpenSocketInfo *ParentSocket, int32 ConnectedSocketIndex) const {
+  const FModuleData &Module = ModuleDatabase->Modules[ModuleIndex];
+  constexpr int32 BroadphaseShift = FPresetAssemblyState::BroadphaseShift;
+
+  // 1. 그리드 + 점유 비트맵 업데이트 (점유 칸만, 빈 칸은 벽으로 남김)
+  const int32 WordOffset = Position.X >> 6;
+  const int32 Shift = Position.X & 63;
   for (int32 Y = 0; Y < Module.Size.Y; Y++) {
+    uint64 *Occ = State.Occupancy.GetData() +
+                  (Position.Y + Y) * State.OccupancyWordsPerRow;
+    const uint64 *Foot =
+        Module.FootprintRows.GetData() + Y * Module.FootprintWordsPerRow;
+    for (int32 W = 0; W < Module.FootprintWordsPerRow; W++) {
+      const uint64 Bits = Foot[W];
+      Occ[WordOffset + W] |= Bits << Shift;
+      if (Shift != 0 && (Bits >> (64 - Shift)) != 0) {
+        Occ[WordOffset + W + 1] |= Bits >> (64 - Shift);
+      }
+    }
+
+    bool bRowOccupied = false;
     for (int32 X = 0; X < Module.Size.X; X++) {
-      FDungeonTile &Tile = Grid.GetTile(Position.X + X, Position.Y + Y);
+      if (!Module.IsFootprintTile(X, Y)) {
+        continue;
+      }
+      bRowOccupied = true;
+      FDungeonTile &Tile = State.Grid.GetTile(Position.X + X, Position.Y + Y);
       Tile.Type = ETileType::Floor; // 일단 바닥으로
       // RoomID를 어떻게 저장할까? Module.ID는 FName인데 Tile.RoomID는 int.
       // 임시로 해시값이나 인덱스를 넣을 수 있음. 여기선 생략.
     }
+
+    // 거친 블록 표시 (행 단위로 AABB 가로 범위를 표시, 보수적)
+    if (bRowOccupied) {
+      const int32 CY = (Position.Y + Y) >> BroadphaseShift;
+      const int32 CX0 = Position.X >> BroadphaseShift;
+      const int32 CX1 = (Position.X + Module.Size.X - 1) >> BroadphaseShift;
+      uint64 *Coarse =
+          State.CoarseOccupancy.GetData() + CY * State.CoarseWordsPerRow;
+      for (int32 W = CX0 >> 6; W <= CX1 >> 6; W++) {
+        Coarse[W] |= RangeMaskInWord(W, CX0, CX1);
+      }
+    }
+  }
+
+  // 2. 배치 정보 기록 (연결 트리)
+  const int32 PlacedIndex = State.PlacedModules.Num();
+  FPlacedModule &Placed = State.PlacedModules.AddDefaulted_GetRef();
+  Placed.ModuleID = Module.ModuleID;
+  Placed.Position = Position;
+  Placed.Size = Module.Size;
+  Placed.ModuleIndex = ModuleIndex;
+  if (ParentSocket) {
+    Placed.ParentIndex = ParentSocket->OwnerIndex;
+    Placed.ParentSocket = *ParentSocket;
+    FPlacedModule &Parent = State.PlacedModules[ParentSocket->OwnerIndex];
+    Parent.ChildCount++;
+    Placed.Depth = Parent.Depth + 1;
   }
 
-  // 2. 배치 정보 기록
-  PlacedModules.Add({Module.ModuleID, Position, Module.Size});
+  // 3. 소켓 정보 추가 (월드 좌표 계산, 연결된 소켓 제외)
+  for (int32 i = 0; i < Module.Sockets.Num(); i++) {
+    if (i == ConnectedSocketIndex)
+      continue;
 
-  // 3. 소켓 정보 반환 (월드 좌표 계산)
-  for (const FModuleSocket &Socket : Module.Sockets) {
     FOpenSocketInfo Info;
-    Info.SocketData = Socket;
-    Info.WorldPosition = Position + Socket.LocalPosition;
-    OutNewSockets.Add(Info);
+    Info.SocketData = Module.Sockets[i];
+    Info.WorldPosition = Position + Module.Sockets[i].LocalPosition;
+    Info.OwnerIndex = PlacedIndex;
+    State.OpenSockets.Add(Info);
   }
 }
 
-EModuleSocketDirection
-UPresetAssemblyGenerator::GetOppositeDirection(EModuleSocketDirection Dir) {
-  switch (Dir) {
-  case EModuleSocketDirection::North:
-    return EModuleSocketDirection::South;
-  case EModuleSocketDirection::East:
-    return EModuleSocketDirection::West;
-  case EModuleSocketDirection::South:
-    return EModuleSocketDirection::North;
-  case EModuleSocketDirection::West:
-    return EModuleSocketDirection::East;
-  default:
-    return EModuleSocketDirection::North;
+bool UPresetAssemblyGenerator::BacktrackLastModule(
+    FPresetAssemblyState &State) const {
+  // Start 모듈은 되돌리지 않음. 마지막 모듈은 항상 자식이 없음
+  const int32 LastIndex = State.PlacedModules.Num() - 1;
+  if (LastIndex <= 0) {
+    return false;
   }
-}
+  const FPlacedModule Last = State.PlacedModules[LastIndex];
+  const FModuleData &Module = ModuleDatabase->Modules[Last.ModuleIndex];
+
+  // 1. 점유 비트/타일 해제 (모듈끼리 겹치지 않으므로 이 모듈 비트만 지움)
+  const int32 WordOffset = Last.Position.X >> 6;
+  const int32 Shift = Last.Position.X & 63;
+  for (int32 Y = 0; Y < Module.Size.Y; Y++) {
+    uint64 *Occ = State.Occupancy.GetData() +
+                  (Last.Position.Y + Y) * State.OccupancyWordsPerRow;
+    const uint64 *Foot =
+        Module.FootprintRows.GetData() + Y * Module.FootprintWordsPerRow;
+    for (int32 W = 0; W < Module.FootprintWordsPerRow; W++) {
+      const uint64 Bits = Foot[W];
+      Occ[WordOffset + W] &= ~(Bits << Shift);
+      if (Shift != 0 && (Bits >> (64 - Shift)) != 0) {
+        Occ[WordOffset + W + 1] &= ~(Bits >> (64 - Shift));
+      }
+    }
+    for (int32 X = 0; X < Module.Size.X; X++) {
+      if (Module.IsFootprintTile(X, Y)) {
+        State.Grid.GetTile(Last.Position.X + X, Last.Position.Y + Y).Type =
+            ETileType::Wall;
+      }
+    }
+  }
+
+  // 2. 연결 트리에서 제거
+  State.PlacedModules[Last.ParentIndex].ChildCount--;
+  State.PlacedModules.RemoveAt(LastIndex, 1, EAllowShrinking::No);
 
-FIntPoint
-UPresetAssemblyGenerator::GetDirectionOffset(EModuleSocketDirection Dir) {
-  switch (Dir) {
-  case EModuleSocketDirection::North:
-    return FIntPoint(0, 1);
-  case EModuleSocketDirection::East:
-    return FIntPoint(1, 0);
-  case EModuleSocketDirection::South:
-    return FIntPoint(0, -1);
-  case EModuleSocketDirection::West:
-    return FIntPoint(-1, 0);
-  default:
-    return FIntPoint(0, 0);
+  // 3. 막혔던 소켓 중 살아 있는 모듈의 것은 다시 대기열로 (공간이 생겼을 수
+  // 있음), 부모 소켓은 방금 모듈을 빼고 다시 시도
+  for (const FOpenSocketInfo &Dead : State.DeadSockets) {
+    if (Dead.OwnerIndex != LastIndex) {
+      State.OpenSockets.Add(Dead);
+    }
   }
+  State.DeadSockets.Reset();
+
+  FOpenSocketInfo Retry = Last.ParentSocket;
+  Retry.ExcludedModuleIndex = Last.ModuleIndex;
+  State.OpenSockets.Add(Retry);
+  return true;
 }
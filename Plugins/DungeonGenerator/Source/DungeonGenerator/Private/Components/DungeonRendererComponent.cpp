@@ -41,6 +41,9 @@ void UDungeonRendererComponent::GenerateDungeon(
 
   // Apply Theme
   TileRenderer->ApplyTheme(Theme);
+  if (bOverrideWallAutotileMode) {
+    TileRenderer->WallAutotileMode = WallAutotileMode;
+  }
 
   // Set ChunkSize from Config (Used for grouping)
   TileRenderer->ChunkSize = Config.ChunkSize;
@@ -69,66 +72,86 @@ void UDungeonRendererComponent::GenerateDungeon(
     CeilingHISM->ClearInstances();
   }
 
-  // Generate Meshes (HISMs)
+  // Generate Meshes (HISMs), recording chunk membership in the registry
   TileRenderer->GenerateBSPTilesMultiMesh(Grid, Owner, CeilingHISM, FloorHISM,
-                                          CreatedWallHISMs);
+                                          CreatedWallHISMs, &ChunkRegistry);
+  ChunkRegistry.BuildWallHISMMap(ChunkHISMMap);
+
+  // Mesh Merging: chunk meshes are built on worker threads, the HISMs stay
+  // visible until HandleChunksMerged swaps the merged components in
+  if (Config.bEnableChunkMerging && ChunkHISMMap.Num() > 0) {
+    const int32 RequestId = MergeRequestId;
+    const bool bRemoveOriginal = Config.bRemoveOriginalAfterMerge;
+    TWeakObjectPtr<UDungeonRendererComponent> WeakThis(this);
+    TWeakObjectPtr<UDungeonChunkStreamer> WeakStreamer(ChunkStreamer);
+
+    UDungeonMeshMerger::MergeHISMsPerChunkAsync(
+        Owner, ChunkHISMMap, TEXT("MergedDungeon"),
+        [WeakThis, WeakStreamer, RequestId, bRemoveOriginal](
+            const TMap<FIntPoint, UDynamicMeshComponent *> &Merged) {
+          if (UDungeonRendererComponent *Self = WeakThis.Get()) {
+            Self->HandleChunksMerged(RequestId, Merged, bRemoveOriginal,
+                                     WeakStreamer.Get());
+            return;
+          }
+          for (const auto &Pair : Merged) {
+            Pair.Value->DestroyComponent();
+          }
+        },
+        [WeakThis, RequestId]() {
+          // Skip building components for a merge made stale by ClearDungeon
+          const UDungeonRendererComponent *Self = WeakThis.Get();
+          return Self && Self->MergeRequestId == RequestId;
+        });
+  }
 
-  // Populate ChunkHISMMap from CreatedWallHISMs directly
-  ChunkHISMMap.Empty();
-  for (UHierarchicalInstancedStaticMeshComponent *HISM : CreatedWallHISMs) {
-    if (IsValid(HISM)) {
-      // Parse Tags for Chunk Coord (Faster than name parsing)
-      // Assuming GenerateBSPTilesMultiMesh already added tags
-      int32 ChunkX = 0;
-      int32 ChunkY = 0;
-      bool bFound = false;
-
-      for (const FName &Tag : HISM->ComponentTags) {
-        FString TagStr = Tag.ToString();
-        if (TagStr.StartsWith(TEXT("ChunkX:"))) {
-          ChunkX = FCString::Atoi(*TagStr.Mid(7));
-          bFound = true;
-        } else if (TagStr.StartsWith(TEXT("ChunkY:"))) {
-          ChunkY = FCString::Atoi(*TagStr.Mid(7));
-          bFound = true;
-        }
-      }
+  // Update Streamer if provided
+  if (ChunkStreamer) {
+    ChunkStreamer->ApplyChunkRegistry(ChunkRegistry);
 
-      if (bFound) {
-        ChunkHISMMap.FindOrAdd(FIntPoint(ChunkX, ChunkY)).Add(HISM);
-      }
+    // Force Show All initially
+    ChunkStreamer->ShowAllChunks();
+  }
+}
+
+void UDungeonRendererComponent::HandleChunksMerged(
+    int32 RequestId, const TMap<FIntPoint, UDynamicMeshComponent *> &Merged,
+    bool bRemoveOriginal, UDungeonChunkStreamer *ChunkStreamer) {
+  // Dungeon was cleared or regenerated while the merge was running
+  if (RequestId != MergeRequestId) {
+    for (const auto &Pair : Merged) {
+      Pair.Value->DestroyComponent();
     }
+    return;
   }
 
-  // Mesh Merging
-  if (Config.bEnableChunkMerging) {
-    // Merge HISMs per chunk
-    MergedChunkMeshes = UDungeonMeshMerger::MergeHISMsPerChunk(
-        Owner, ChunkHISMMap, TEXT("MergedDungeon"));
-
-    if (Config.bRemoveOriginalAfterMerge) {
-      // Destroy original HISMs
-      for (UHierarchicalInstancedStaticMeshComponent *HISM : CreatedWallHISMs) {
-        if (IsValid(HISM)) {
-          HISM->DestroyComponent();
-        }
+  MergedChunkMeshes = Merged;
+  for (const auto &Pair : MergedChunkMeshes) {
+    ChunkRegistry.SetMergedMesh(Pair.Key, Pair.Value);
+  }
+
+  if (bRemoveOriginal) {
+    // Destroy original HISMs
+    for (UHierarchicalInstancedStaticMeshComponent *HISM : CreatedWallHISMs) {
+      if (IsValid(HISM)) {
+        HISM->DestroyComponent();
       }
-      CreatedWallHISMs.Empty();
-      ChunkHISMMap.Empty();
     }
+    CreatedWallHISMs.Empty();
+    ChunkHISMMap.Empty();
+    ChunkRegistry.ClearWallHISMs();
   }
 
-  // Update Streamer if provided
   if (ChunkStreamer) {
-    ChunkStreamer->ChunkHISMMap = ChunkHISMMap;
-    ChunkStreamer->ChunkMergedMeshMap = MergedChunkMeshes;
-
-    // Force Show All initially
+    ChunkStreamer->ApplyChunkRegistry(ChunkRegistry);
     ChunkStreamer->ShowAllChunks();
   }
 }
 
 void UDungeonRendererComponent::ClearDungeon() {
+  // Results of an in-flight merge belong to the old dungeon
+  MergeRequestId++;
+
   // Destroy all managed HISMs
   for (UHierarchicalInstancedStaticMeshComponent *HISM : CreatedWallHISMs) {
     if (IsValid(HISM)) {
@@ -137,6 +160,7 @@ void UDungeonRendererComponent::ClearDungeon() {
   }
   CreatedWallHISMs.Empty();
   ChunkHISMMap.Empty();
+  ChunkRegistry.Reset();
 
   // Destroy Merged Meshes
   for (auto &Pair : MergedChunkMeshes) {
@@ -155,75 +179,35 @@ void UDungeonRendererComponent::RebuildChunkMaps() {
   if (!Owner)
     return;
 
-  TArray<UHierarchicalInstancedStaticMeshComponent *> AllHISMs;
-  Owner->GetComponents<UHierarchicalInstancedStaticMeshComponent>(AllHISMs);
+  // Levels saved before the registry existed: migrate once from tags/names
+  if (ChunkRegistry.Num() == 0) {
+    const int32 Migrated = ChunkRegistry.MigrateFromComponents(Owner);
+    if (Migrated > 0) {
+      UE_LOG(LogTemp, Log,
+             TEXT("UDungeonRendererComponent: Migrated %d legacy chunks into "
+                  "the chunk registry."),
+             Migrated);
+    }
+  }
 
-  int32 FoundChunks = 0;
+  // Drop references to components that did not survive load/duplication
+  ChunkRegistry.RemoveInvalid();
+  ChunkRegistry.BuildWallHISMMap(ChunkHISMMap);
+  ChunkRegistry.BuildMergedMeshMap(MergedChunkMeshes);
 
-  for (UHierarchicalInstancedStaticMeshComponent *HISM : AllHISMs) {
-    if (!IsValid(HISM))
-      continue;
+  const bool bIsPIE = Owner->GetWorld() && Owner->GetWorld()->IsPlayInEditor();
+
+  for (const auto &Pair : ChunkHISMMap) {
+    for (UHierarchicalInstancedStaticMeshComponent *HISM : Pair.Value) {
+      CreatedWallHISMs.Add(HISM);
 
-    FString CompName = HISM->GetName();
-    // Parse "Wall_C{X}_{Y}"
-    if (CompName.StartsWith(TEXT("Wall_C"))) {
       // Ensure Visible
       HISM->SetVisibility(true, true);
       HISM->SetHiddenInGame(false, true);
 
-      // Optimization: Try parsing Tags first
-      bool bFoundTags = false;
-      int32 ChunkX = 0;
-      int32 ChunkY = 0;
-
-      for (const FName &Tag : HISM->ComponentTags) {
-        FString TagStr = Tag.ToString();
-        if (TagStr.StartsWith(TEXT("ChunkX:"))) {
-          ChunkX = FCString::Atoi(*TagStr.Mid(7));
-          bFoundTags = true;
-        } else if (TagStr.StartsWith(TEXT("ChunkY:"))) {
-          ChunkY = FCString::Atoi(*TagStr.Mid(7));
-          bFoundTags = true;
-        }
-      }
-
-      bool bIsDungeonComp = false;
-
-      if (bFoundTags) {
-        // Tags found, use them
-        FIntPoint ChunkCoord(ChunkX, ChunkY);
-        ChunkHISMMap.FindOrAdd(ChunkCoord).Add(HISM);
-        bIsDungeonComp = true;
-        FoundChunks++;
-      } else {
-        // Fallback: Parse Name (Legacy)
-        int32 CIndex = CompName.Find(TEXT("_C")) + 2;
-        int32 UnderscoreIndex = CompName.Find(
-            TEXT("_"), ESearchCase::IgnoreCase, ESearchDir::FromStart, CIndex);
-        int32 MIndex = CompName.Find(TEXT("_M"));
-
-        if (UnderscoreIndex != INDEX_NONE && MIndex != INDEX_NONE) {
-          FString XStr = CompName.Mid(CIndex, UnderscoreIndex - CIndex);
-          FString YStr =
-              CompName.Mid(UnderscoreIndex + 1, MIndex - UnderscoreIndex - 1);
-
-          ChunkX = FCString::Atoi(*XStr);
-          ChunkY = FCString::Atoi(*YStr);
-          FIntPoint ChunkCoord(ChunkX, ChunkY);
-
-          ChunkHISMMap.FindOrAdd(ChunkCoord).Add(HISM);
-          bIsDungeonComp = true;
-          FoundChunks++;
-        }
-      }
-
-      if (bIsDungeonComp) {
-        CreatedWallHISMs.Add(HISM);
-      }
-
       // Force Collision Update (PIE Hotfix logic migrated)
       // Note: This matches the logic in DungeonFullTestActor::RebuildChunkMaps
-      if (HISM->GetWorld()->IsPlayInEditor()) {
+      if (bIsPIE) {
         HISM->SetCollisionProfileName(
             UCollisionProfile::BlockAllDynamic_ProfileName);
         HISM->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
@@ -10,3 +10,148 @@ UPresetModuleDatabase::GetModulesByType(EDungeonPresetModuleType InType) const {
   }
   return Result;
 }
+
+void UPresetModuleDatabase::PostLoad() {
+  Super::PostLoad();
+  BuildRuntimeData();
+}
+
+#if WITH_EDITOR
+void UPresetModuleDatabase::PostEditChangeProperty(
+    FPropertyChangedEvent &PropertyChangedEvent) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  BuildRuntimeData();
+}
+#endif
+
+void FModuleData::BuildFootprint() {
+  FootprintWordsPerRow = Size.X > 0 ? (Size.X + 63) / 64 : 0;
+  FootprintRows.Reset();
+  if (FootprintWordsPerRow == 0 || Size.Y <= 0) {
+    return;
+  }
+
+  // 전체 점유로 시작 (마지막 워드는 Size.X 너머 비트를 0으로)
+  FootprintRows.Init(~uint64(0), FootprintWordsPerRow * Size.Y);
+  const int32 TailBits = Size.X & 63;
+  if (TailBits != 0) {
+    for (int32 Y = 0; Y < Size.Y; Y++) {
+      FootprintRows[Y * FootprintWordsPerRow + FootprintWordsPerRow - 1] =
+          (uint64(1) << TailBits) - 1;
+    }
+  }
+
+  for (const FIntPoint &Void : VoidTiles) {
+    if (Void.X >= 0 && Void.X < Size.X && Void.Y >= 0 && Void.Y < Size.Y) {
+      FootprintRows[Void.Y * FootprintWordsPerRow + (Void.X >> 6)] &=
+          ~(uint64(1) << (Void.X & 63));
+    }
+  }
+}
+
+void UPresetModuleDatabase::BuildRuntimeData() {
+  for (FModuleData &Module : Modules) {
+    Module.BuildFootprint();
+  }
+
+  for (FDirectionIndex &DirIndex : SocketIndex) {
+    DirIndex = FDirectionIndex();
+  }
+
+  auto AddMatch = [](FModuleSocketBucket &Bucket,
+                     const FModuleSocketMatch &Match) {
+    Bucket.Matches.Add(Match);
+    Bucket.TotalWeight += Match.Weight;
+  };
+
+  // 1. 태그별 버킷 생성 (같은 태그 소켓)
+  for (int32 ModuleIndex = 0; ModuleIndex < Modules.Num(); ModuleIndex++) {
+    const FModuleData &Module = Modules[ModuleIndex];
+    // Start 모듈은 루트 전용, 가중치 0은 비활성
+    if (Module.Type == EDungeonPresetModuleType::Start ||
+        Module.SelectionWeight <= 0.0f) {
+      continue;
+    }
+
+    for (int32 SocketIdx = 0; SocketIdx < Module.Sockets.Num(); SocketIdx++) {
+      const FModuleSocket &Socket = Module.Sockets[SocketIdx];
+
+      // 대상 소켓은 이 소켓의 반대 방향을 바라보므로, 대상에서 한 칸 전진한
+      // 위치가 이 소켓이 됨: 원점 = 대상 + 전진 - 로컬 위치
+      FModuleSocketMatch Match;
+      Match.ModuleIndex = ModuleIndex;
+      Match.SocketIndex = SocketIdx;
+      Match.OriginOffset =
+          GetDirectionOffset(GetOppositeDirection(Socket.Direction)) -
+          Socket.LocalPosition;
+      Match.Weight = Module.SelectionWeight;
+
+      FDirectionIndex &DirIndex = SocketIndex[(int32)Socket.Direction];
+      AddMatch(DirIndex.AnyTag, Match);
+      if (Socket.SocketTag.IsNone()) {
+        AddMatch(DirIndex.UntaggedOnly, Match);
+      } else {
+        AddMatch(DirIndex.ByTag.FindOrAdd(Socket.SocketTag), Match);
+      }
+    }
+  }
+
+  // 2. None 소켓은 모든 태그와 호환되므로 각 태그 버킷에 합침 (조회 시 병합
+  // 불필요)
+  for (FDirectionIndex &DirIndex : SocketIndex) {
+    for (TPair<FName, FModuleSocketBucket> &Pair : DirIndex.ByTag) {
+      for (const FModuleSocketMatch &Match : DirIndex.UntaggedOnly.Matches) {
+        AddMatch(Pair.Value, Match);
+      }
+    }
+  }
+
+  bRuntimeDataBuilt = true;
+}
+
+const FModuleSocketBucket &
+UPresetModuleDatabase::FindSocketMatches(EModuleSocketDirection TargetDirection,
+                                         FName TargetTag) const {
+  // 후보 소켓은 대상의 반대 방향이어야 함 (North -> South)
+  const FDirectionIndex &DirIndex =
+      SocketIndex[(int32)GetOppositeDirection(TargetDirection)];
+
+  if (TargetTag.IsNone()) {
+    return DirIndex.AnyTag;
+  }
+  if (const FModuleSocketBucket *Bucket = DirIndex.ByTag.Find(TargetTag)) {
+    return *Bucket;
+  }
+  return DirIndex.UntaggedOnly;
+}
+
+EModuleSocketDirection
+UPresetModuleDatabase::GetOppositeDirection(EModuleSocketDirection Dir) {
+  switch (Dir) {
+  case EModuleSocketDirection::North:
+    return EModuleSocketDirection::South;
+  case EModuleSocketDirection::East:
+    return EModuleSocketDirection::West;
+  case EModuleSocketDirection::South:
+    return EModuleSocketDirection::North;
+  case EModuleSocketDirection::West:
+    return EModuleSocketDirection::East;
+  default:
+    return EModuleSocketDirection::North;
+  }
+}
+
+FIntPoint UPresetModuleDatabase::GetDirectionOffset(EModuleSocketDirection Dir) {
+  switch (Dir) {
+  case EModuleSocketDirection::North:
+    return FIntPoint(0, 1);
+  case EModuleSocketDirection::East:
+    return FIntPoint(1, 0);
+  case EModuleSocketDirection::South:
+    return FIntPoint(0, -1);
+  case EModuleSocketDirection::West:
+    return FIntPoint(-1, 0);
+  default:
+    return FIntPoint(0, 0);
+  }
+}
@@ -3,6 +3,7 @@
 #include "Algorithms/BSPGenerator.h"
 #include "Algorithms/CellularAutomataGenerator.h"
 #include "Rendering/DungeonMeshMerger.h"
+#include "Rendering/DungeonChunkRegistry.h"
 
 ADungeonFullTestActor::ADungeonFullTestActor() {
     PrimaryActorTick.bCanEverTick = false;
@@ -112,8 +113,8 @@ void ADungeonFullTestActor::Generate() {
             Renderer->CeilingMesh = CeilingMesh->GetStaticMesh();
         }
 
-        // Execute Multi-Mesh Render (HISM 방식)
-        Renderer->GenerateBSPTilesMultiMesh(Grid, this, CeilingMesh, FloorMesh, CreatedWallHISMs);
+        // Execute Multi-Mesh Render (HISM 방식, 청크 소속은 레지스트리에 기록)
+        Renderer->GenerateBSPTilesMultiMesh(Grid, this, CeilingMesh, FloorMesh, CreatedWallHISMs, &ChunkRegistry);
     }
 
     // Props (Simple Example)
@@ -150,6 +151,9 @@ void ADungeonFullTestActor::Generate() {
     if (bEnableChunkMerging && bUseChunking && ChunkHISMMap.Num() > 0) {
         ChunkMergedWallMap = UDungeonMeshMerger::MergeHISMsPerChunk(
             this, ChunkHISMMap, TEXT("MergedWall"));
+        for (const auto& Pair : ChunkMergedWallMap) {
+            ChunkRegistry.SetMergedMesh(Pair.Key, Pair.Value);
+        }
 
         // 원본 HISM 제거 (옵션)
         if (bRemoveOriginalAfterMerge) {
@@ -209,6 +213,7 @@ void ADungeonFullTestActor::Clear() {
     }
     ChunkMergedWallMap.Empty();
     ChunkHISMMap.Empty();
+    ChunkRegistry.Reset();
 
     // 스트리머 데이터 초기화
     if (ChunkStreamer) {
@@ -310,7 +315,7 @@ void ADungeonFullTestActor::PostLoad() {
                 Renderer->CeilingMesh = CeilingMesh->GetStaticMesh();
             }
             
-            Renderer->GenerateBSPTilesMultiMesh(StoredGrid, this, CeilingMesh, FloorMesh, CreatedWallHISMs);
+            Renderer->GenerateBSPTilesMultiMesh(StoredGrid, this, CeilingMesh, FloorMesh, CreatedWallHISMs, &ChunkRegistry);
             
             UE_LOG(LogTemp, Log, TEXT("ADungeonFullTestActor::PostLoad - Regenerated %d wall HISMs"), CreatedWallHISMs.Num());
             
@@ -352,18 +357,24 @@ void ADungeonFullTestActor::RebuildChunkMaps() {
     
     ChunkHISMMap.Empty();
     CreatedWallHISMs.Empty(); // 다시 채움
-    
-    TArray<UHierarchicalInstancedStaticMeshComponent*> AllWallHISMs;
-    GetComponents<UHierarchicalInstancedStaticMeshComponent>(AllWallHISMs);
-    
-    int32 FoundChunks = 0;
-    
-    for (UHierarchicalInstancedStaticMeshComponent* HISM : AllWallHISMs) {
-        if (!IsValid(HISM)) continue;
 
-        FString CompName = HISM->GetName();
-        // Wall_C{X}_{Y}_M{Mask} 형식 파싱
-        if (CompName.StartsWith(TEXT("Wall_C"))) {
+    // 레지스트리 이전에 저장된 레벨: 컴포넌트 태그/이름에서 한 번만 이전
+    if (ChunkRegistry.Num() == 0) {
+        const int32 Migrated = ChunkRegistry.MigrateFromComponents(this);
+        if (Migrated > 0) {
+            UE_LOG(LogTemp, Log, TEXT("DungeonFullTestActor: Migrated %d legacy chunks into chunk registry"), Migrated);
+        }
+    }
+
+    // 로드/PIE 복제 후 사라진 컴포넌트 참조 정리
+    ChunkRegistry.RemoveInvalid();
+    ChunkRegistry.BuildWallHISMMap(ChunkHISMMap);
+    ChunkRegistry.BuildMergedMeshMap(ChunkMergedWallMap);
+
+    for (const auto& Pair : ChunkHISMMap) {
+        for (UHierarchicalInstancedStaticMeshComponent* HISM : Pair.Value) {
+            CreatedWallHISMs.Add(HISM);
+
             // 로드된 HISM 가시성 보장 (기본값)
             if (bEnableChunkStreaming && ChunkStreamer) {
                 // 스트리밍 켜져있으면 일단 숨기고 시작할 수도 있지만,
@@ -397,77 +408,18 @@ void ADungeonFullTestActor::RebuildChunkMaps() {
                     }
                 }
             }
-
-            int32 CIndex = CompName.Find(TEXT("_C")) + 2;
-            int32 UnderscoreIndex = CompName.Find(TEXT("_"), ESearchCase::IgnoreCase, ESearchDir::FromStart, CIndex);
-            int32 MIndex = CompName.Find(TEXT("_M"));
-            
-            if (UnderscoreIndex != INDEX_NONE && MIndex != INDEX_NONE) {
-                FString XStr = CompName.Mid(CIndex, UnderscoreIndex - CIndex);
-                FString YStr = CompName.Mid(UnderscoreIndex + 1, MIndex - UnderscoreIndex - 1);
-                
-                int32 ChunkX = FCString::Atoi(*XStr);
-                int32 ChunkY = FCString::Atoi(*YStr);
-                FIntPoint ChunkCoord(ChunkX, ChunkY);
-                
-                ChunkHISMMap.FindOrAdd(ChunkCoord).Add(HISM);
-                
-                if (!CreatedWallHISMs.Contains(HISM)) {
-                    CreatedWallHISMs.Add(HISM);
-                }
-                
-                FoundChunks++;
-
-                // DEBUG: Log details for the first few chunks to verify PIE state
-                if (FoundChunks <= 5) {
-                    UE_LOG(LogTemp, Warning, TEXT("[DEBUG] Found Wall HISM: %s"), *CompName);
-                }
-            }
         }
     }
-    
-           
-    
-    // 2. Rebuild ChunkMergedWallMap (Scan for existing Merged Meshes)
-    ChunkMergedWallMap.Empty();
-    TArray<UDynamicMeshComponent*> AllMergedMeshes;
-    GetComponents<UDynamicMeshComponent>(AllMergedMeshes);
-    
-    int32 FoundMerged = 0;
-    for (UDynamicMeshComponent* Mesh : AllMergedMeshes)
-    {
-         if (!Mesh) continue;
-         FString CompName = Mesh->GetName();
-         
-         // Pattern: MergedWall_C{X}_{Y}
-         if (CompName.StartsWith(TEXT("MergedWall_C")))
-         {
-             // Force visibility settings for streaming control
-             if (bEnableChunkStreaming && ChunkStreamer) {
-                 Mesh->SetVisibility(true, true);
-             }
-             
-             // Parse Coord
-             int32 CIndex = CompName.Find(TEXT("_C")) + 2;
-             int32 UnderscoreIndex = CompName.Find(TEXT("_"), ESearchCase::IgnoreCase, ESearchDir::FromStart, CIndex);
-             
-             if (UnderscoreIndex != INDEX_NONE)
-             {
-                 FString XStr = CompName.Mid(CIndex, UnderscoreIndex - CIndex);
-                 FString YStr = CompName.Mid(UnderscoreIndex + 1);
-                 
-                 int32 ChunkX = FCString::Atoi(*XStr);
-                 int32 ChunkY = FCString::Atoi(*YStr);
-                 FIntPoint ChunkCoord(ChunkX, ChunkY);
-                 
-                 ChunkMergedWallMap.Add(ChunkCoord, Mesh);
-                 FoundMerged++;
-             }
-         }
+
+    // 머지 메시 가시성 (스트리밍 제어용)
+    if (bEnableChunkStreaming && ChunkStreamer) {
+        for (const auto& Pair : ChunkMergedWallMap) {
+            Pair.Value->SetVisibility(true, true);
+        }
     }
 
     UE_LOG(LogTemp, Log, TEXT("DungeonFullTestActor: Rebuilt chunk map with %d HISM chunks and %d Merged meshes"), 
-        ChunkHISMMap.Num(), FoundMerged);
+        ChunkHISMMap.Num(), ChunkMergedWallMap.Num());
         
     // 스트리머 설정 업데이트
     if (ChunkStreamer) {
@@ -476,8 +428,7 @@ void ADungeonFullTestActor::RebuildChunkMaps() {
         ChunkStreamer->UpdateInterval = StreamingUpdateInterval;
         ChunkStreamer->TileSize = TileSize;
         ChunkStreamer->ChunkSize = ChunkSize;
-        ChunkStreamer->ChunkHISMMap = ChunkHISMMap;
-        ChunkStreamer->ChunkMergedMeshMap = ChunkMergedWallMap; // MergedMap은 아직 복구 안함(나중에 추가 필요)
+        ChunkStreamer->ApplyChunkRegistry(ChunkRegistry);
         
         if (!bEnableChunkStreaming) {
             ChunkStreamer->ShowAllChunks();
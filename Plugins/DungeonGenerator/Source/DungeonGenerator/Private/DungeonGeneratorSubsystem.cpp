@@ -1,6 +1,7 @@
 #include "DungeonGeneratorSubsystem.h"
 #include "Algorithms/BSPGenerator.h"
 #include "Algorithms/CellularAutomataGenerator.h"
+#include "Async/Async.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "ProceduralMeshComponent.h"
 #include "Rendering/DungeonLightingManager.h"
@@ -23,6 +24,7 @@ void UDungeonGeneratorSubsystem::Initialize(
 }
 
 void UDungeonGeneratorSubsystem::Deinitialize() {
+  WaitForAsyncJob();
   ClearRenderedDungeon();
   Super::Deinitialize();
   UE_LOG(LogTemp, Log, TEXT("DungeonGeneratorSubsystem Deinitialized"));
@@ -40,6 +42,9 @@ FDungeonGrid UDungeonGeneratorSubsystem::GenerateDungeon(
     return CurrentGrid; // Return empty/previous grid
   }
 
+  // Async job shares the cached algorithm instance
+  WaitForAsyncJob();
+
   // Initialize Grid (clears previous state)
   CurrentGrid.Init(Width, Height, ETileType::Wall);
 
@@ -50,9 +55,29 @@ FDungeonGrid UDungeonGeneratorSubsystem::GenerateDungeon(
          TEXT("GenerateDungeon: Starting generation %dx%d with seed %d"), Width,
          Height, Seed);
 
-  // Create algorithm instance (fresh instance for each generation)
-  UDungeonAlgorithm *Algo = nullptr;
+  // Get algorithm instance (created once per type)
+  UDungeonAlgorithm *Algo = GetAlgorithm(AlgorithmType);
+  if (!Algo) {
+    UE_LOG(LogTemp, Error, TEXT("GenerateDungeon: Unknown algorithm type"));
+    return CurrentGrid;
+  }
+
+  // Generate dungeon
+  if (Algo) {
+    Algo->Generate(CurrentGrid, RandomStream);
+    UE_LOG(LogTemp, Log, TEXT("GenerateDungeon: Generation complete"));
+  }
+
+  return CurrentGrid;
+}
 
+UDungeonAlgorithm *
+UDungeonGeneratorSubsystem::GetAlgorithm(EDungeonAlgorithmType AlgorithmType) {
+  if (UDungeonAlgorithm **Found = AlgorithmCache.Find(AlgorithmType)) {
+    return *Found;
+  }
+
+  UDungeonAlgorithm *Algo = nullptr;
   switch (AlgorithmType) {
   case EDungeonAlgorithmType::BSP:
     Algo = NewObject<UBSPGenerator>(this);
@@ -61,17 +86,171 @@ FDungeonGrid UDungeonGeneratorSubsystem::GenerateDungeon(
     Algo = NewObject<UCellularAutomataGenerator>(this);
     break;
   default:
-    UE_LOG(LogTemp, Error, TEXT("GenerateDungeon: Unknown algorithm type"));
-    return CurrentGrid;
+    return nullptr;
   }
 
-  // Generate dungeon
-  if (Algo) {
-    Algo->Generate(CurrentGrid, RandomStream);
-    UE_LOG(LogTemp, Log, TEXT("GenerateDungeon: Generation complete"));
+  AlgorithmCache.Add(AlgorithmType, Algo);
+  return Algo;
+}
+
+int32 UDungeonGeneratorSubsystem::GenerateDungeonAsync(
+    const FDungeonAsyncGenerationSettings &Settings,
+    FOnDungeonAsyncProgress OnProgress, FOnDungeonAsyncFinished OnFinished) {
+  if (Settings.Width < 10 || Settings.Height < 10) {
+    UE_LOG(LogTemp, Error,
+           TEXT("GenerateDungeonAsync: Grid size too small (%dx%d), minimum "
+                "10x10"),
+           Settings.Width, Settings.Height);
+    return 0;
   }
 
-  return CurrentGrid;
+  // Only one request at a time (previous one finishes as cancelled)
+  WaitForAsyncJob();
+
+  UDungeonAlgorithm *Algo = GetAlgorithm(Settings.AlgorithmType);
+  if (!Algo) {
+    UE_LOG(LogTemp, Error,
+           TEXT("GenerateDungeonAsync: Unknown algorithm type"));
+    return 0;
+  }
+
+  FAsyncJobPtr Job = MakeShared<FAsyncJob, ESPMode::ThreadSafe>();
+  Job->RequestId = NextRequestId++;
+  Job->Settings = Settings;
+  Job->OnProgress = MoveTemp(OnProgress);
+  Job->OnFinished = MoveTemp(OnFinished);
+  ActiveJob = Job;
+
+  UE_LOG(LogTemp, Log,
+         TEXT("GenerateDungeonAsync: Request %d started %dx%d with seed %d"),
+         Job->RequestId, Settings.Width, Settings.Height, Settings.Seed);
+
+  TWeakObjectPtr<UDungeonGeneratorSubsystem> Owner(this);
+  Job->Future = Async(EAsyncExecution::ThreadPool, [Job, Algo, Owner]() {
+    RunAsyncJob(Job, Algo, Owner);
+  });
+
+  return Job->RequestId;
+}
+
+void UDungeonGeneratorSubsystem::RunAsyncJob(
+    const FAsyncJobPtr &Job, UDungeonAlgorithm *Algo,
+    TWeakObjectPtr<UDungeonGeneratorSubsystem> Owner) {
+  const double StartTime = FPlatformTime::Seconds();
+  const FDungeonAsyncGenerationSettings &Settings = Job->Settings;
+  FDungeonGenerationResult &Result = Job->Result;
+
+  // Single stream through all stages (deterministic for a given seed)
+  FRandomStream JobRandom(Settings.Seed);
+
+  auto ReportProgress = [&Job, &Owner](float Progress,
+                                       EDungeonGenerationStage Stage) {
+    Job->Progress = Progress;
+    AsyncTask(ENamedThreads::GameThread, [Owner, Job, Progress, Stage]() {
+      if (UDungeonGeneratorSubsystem *Subsystem = Owner.Get()) {
+        Subsystem->HandleAsyncProgress(Job, Progress, Stage);
+      }
+    });
+  };
+
+  // 1. Grid
+  ReportProgress(0.0f, EDungeonGenerationStage::Grid);
+  Result.Grid.Init(Settings.Width, Settings.Height, ETileType::Wall);
+  Algo->Generate(Result.Grid, JobRandom);
+
+  // 2. Analysis
+  if (!Job->bCancelled && Settings.bCalculateMonsterZones) {
+    ReportProgress(0.5f, EDungeonGenerationStage::MonsterZones);
+    UObjectPlacer::CalculateMonsterZones(
+        Result.Grid, Settings.MonsterZoneRadius, Settings.MinOpenSpace);
+  }
+
+  // 3. Placement
+  if (!Job->bCancelled && Settings.PropConfigs.Num() > 0) {
+    ReportProgress(0.7f, EDungeonGenerationStage::Props);
+    Result.Props =
+        UObjectPlacer::GenerateProps(Result.Grid, Settings.PropConfigs,
+                                     JobRandom,
+                                     Settings.bEnforcePropDiversity);
+  }
+
+  if (!Job->bCancelled && Settings.MaxMonsterClusters > 0) {
+    ReportProgress(0.85f, EDungeonGenerationStage::MonsterClusters);
+    Result.MonsterClusters = UObjectPlacer::FindMonsterClusterLocations(
+        Result.Grid, Settings.MonsterClusterConfig, Result.Props, JobRandom,
+        Settings.MaxMonsterClusters);
+  }
+
+  Result.GenerationTimeMs =
+      (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+  if (!Job->bCancelled) {
+    Job->Progress = 1.0f;
+  }
+
+  AsyncTask(ENamedThreads::GameThread, [Owner, Job]() {
+    if (UDungeonGeneratorSubsystem *Subsystem = Owner.Get()) {
+      Subsystem->HandleAsyncFinished(Job);
+    }
+  });
+}
+
+void UDungeonGeneratorSubsystem::HandleAsyncProgress(
+    const FAsyncJobPtr &Job, float Progress, EDungeonGenerationStage Stage) {
+  if (Job->bCancelled) {
+    return;
+  }
+
+  Job->OnProgress.ExecuteIfBound(Progress, Stage);
+  OnGenerationProgress.Broadcast(Progress, Stage);
+}
+
+void UDungeonGeneratorSubsystem::HandleAsyncFinished(const FAsyncJobPtr &Job) {
+  const bool bCancelled = Job->bCancelled;
+  if (ActiveJob == Job) {
+    ActiveJob.Reset();
+  }
+
+  if (bCancelled) {
+    UE_LOG(LogTemp, Log, TEXT("GenerateDungeonAsync: Request %d cancelled"),
+           Job->RequestId);
+  } else {
+    UE_LOG(LogTemp, Log,
+           TEXT("GenerateDungeonAsync: Request %d complete (%.2f ms)"),
+           Job->RequestId, Job->Result.GenerationTimeMs);
+    Job->OnProgress.ExecuteIfBound(1.0f, EDungeonGenerationStage::Completed);
+    OnGenerationProgress.Broadcast(1.0f, EDungeonGenerationStage::Completed);
+  }
+
+  Job->OnFinished.ExecuteIfBound(bCancelled, Job->Result);
+  OnGenerationFinished.Broadcast(bCancelled, Job->Result);
+
+  // Adopt the grid after listeners have seen it (no extra copy)
+  if (!bCancelled) {
+    CurrentGrid = MoveTemp(Job->Result.Grid);
+  }
+}
+
+void UDungeonGeneratorSubsystem::CancelAsyncGeneration() {
+  if (ActiveJob) {
+    ActiveJob->bCancelled = true;
+  }
+}
+
+float UDungeonGeneratorSubsystem::GetAsyncGenerationProgress() const {
+  return ActiveJob ? ActiveJob->Progress.load() : 0.0f;
+}
+
+void UDungeonGeneratorSubsystem::WaitForAsyncJob() {
+  if (!ActiveJob) {
+    return;
+  }
+
+  // Worker checks the flag between stages; finished callback still arrives
+  ActiveJob->bCancelled = true;
+  if (ActiveJob->Future.IsValid()) {
+    ActiveJob->Future.Wait();
+  }
+  ActiveJob.Reset();
 }
 
 void UDungeonGeneratorSubsystem::RenderDungeon(
@@ -169,6 +348,12 @@ void UDungeonGeneratorSubsystem::RenderDungeon(
       MeshGenerator->bGenerateCeiling = bEnableCeiling;
       MeshGenerator->bGenerateFloor = bEnableFloor;
       MeshGenerator->GenerateCaveWalls(Grid, WallMesh, FloorMesh, CeilingMesh);
+
+      // Chunk wall components are attached to WallMesh; track them so
+      // ClearRenderedDungeon destroys them too
+      for (const auto &Pair : MeshGenerator->WallChunkComponents) {
+        ProceduralMeshComponents.Add(Pair.Value);
+      }
     }
   }
 
@@ -66,8 +66,7 @@ void ADungeonLevelGenerator::BeginPlay()
         }
 
         // Push Data
-		ChunkStreamer->ChunkHISMMap = DungeonRenderer->ChunkHISMMap;
-        ChunkStreamer->ChunkMergedMeshMap = DungeonRenderer->MergedChunkMeshes;
+		ChunkStreamer->ApplyChunkRegistry(DungeonRenderer->ChunkRegistry);
         
         // Initial Update
 		ChunkStreamer->UpdateActiveChunks(GetActorLocation());
@@ -0,0 +1,65 @@
+#include "Generation/AsyncAction_GenerateDungeon.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+UAsyncAction_GenerateDungeon *UAsyncAction_GenerateDungeon::GenerateDungeonAsync(
+    UObject *WorldContextObject,
+    const FDungeonAsyncGenerationSettings &Settings) {
+  UAsyncAction_GenerateDungeon *Action =
+      NewObject<UAsyncAction_GenerateDungeon>();
+  Action->Settings = Settings;
+
+  UWorld *World = GEngine ? GEngine->GetWorldFromContextObject(
+                                WorldContextObject,
+                                EGetWorldErrorMode::LogAndReturnNull)
+                          : nullptr;
+  if (World && World->GetGameInstance()) {
+    Action->Subsystem =
+        World->GetGameInstance()->GetSubsystem<UDungeonGeneratorSubsystem>();
+    Action->RegisterWithGameInstance(World->GetGameInstance());
+  }
+
+  return Action;
+}
+
+void UAsyncAction_GenerateDungeon::Activate() {
+  if (Subsystem) {
+    RequestId = Subsystem->GenerateDungeonAsync(
+        Settings,
+        FOnDungeonAsyncProgress::CreateUObject(
+            this, &UAsyncAction_GenerateDungeon::HandleProgress),
+        FOnDungeonAsyncFinished::CreateUObject(
+            this, &UAsyncAction_GenerateDungeon::HandleFinished));
+  }
+
+  if (RequestId == 0) {
+    UE_LOG(LogTemp, Error,
+           TEXT("AsyncAction_GenerateDungeon: Failed to start generation"));
+    OnCancelled.Broadcast(FDungeonGenerationResult());
+    SetReadyToDestroy();
+  }
+}
+
+void UAsyncAction_GenerateDungeon::Cancel() {
+  // Only cancel our own request, not a newer one
+  if (Subsystem && RequestId != 0 && Subsystem->IsGeneratingAsync() &&
+      Subsystem->GetActiveAsyncRequestId() == RequestId) {
+    Subsystem->CancelAsyncGeneration();
+  }
+}
+
+void UAsyncAction_GenerateDungeon::HandleProgress(
+    float Progress, EDungeonGenerationStage Stage) {
+  OnProgress.Broadcast(Progress, Stage);
+}
+
+void UAsyncAction_GenerateDungeon::HandleFinished(
+    bool bCancelled, const FDungeonGenerationResult &Result) {
+  if (bCancelled) {
+    OnCancelled.Broadcast(Result);
+  } else {
+    OnCompleted.Broadcast(Result);
+  }
+  SetReadyToDestroy();
+}
@@ -35,6 +35,8 @@ FDungeonGrid UDungeonBuilder::BuildDungeon(const FDungeonGenConfig &Config,
         NewObject<UPresetAssemblyGenerator>(Outer);
     if (PresetAlgo) {
       PresetAlgo->MaxRoomCount = Config.MaxRoomCount;
+      PresetAlgo->CandidateCount = Config.PresetCandidateCount;
+      PresetAlgo->MaxBacktrackSteps = Config.PresetMaxBacktrackSteps;
       if (!Config.PresetDatabase.IsNull()) {
         PresetAlgo->ModuleDatabase = Config.PresetDatabase.LoadSynchronous();
       }
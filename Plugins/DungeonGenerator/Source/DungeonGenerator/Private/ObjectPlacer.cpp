@@ -1,5 +1,6 @@
 #include "ObjectPlacer.h"
-#include "Async/ParallelFor.h"
+#include "CoreObjectPlacer.h"
+#include "DungeonCoreAdapters.h"
 #include "Containers/Queue.h"
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
@@ -253,64 +254,15 @@ void UObjectPlacer::CalculateMonsterZones(FDungeonGrid &Grid, float CheckRadius,
                                           int32 MinOpenSpace) {
   TRACE_CPUPROFILER_EVENT_SCOPE(UObjectPlacer::CalculateMonsterZones);
 
-  // Build spatial grid for floor tiles once - O(W × H)
-  FSpatialGrid SpatialGrid(FMath::Max(1, FMath::FloorToInt(CheckRadius)),
-                           Grid.Width);
-
-  for (int32 Y = 0; Y < Grid.Height; Y++) {
-    for (int32 X = 0; X < Grid.Width; X++) {
-      if (Grid.GetTile(X, Y).Type == ETileType::Floor) {
-        SpatialGrid.AddTile(X, Y);
-      }
-    }
-  }
-
-  const float RadiusSq = CheckRadius * CheckRadius;
-  const int32 TotalTiles = Grid.Width * Grid.Height;
-
-  // Parallel processing - Process each tile independently
-  ParallelFor(TotalTiles, [&](int32 Index) {
-    const int32 X = Index % Grid.Width;
-    const int32 Y = Index / Grid.Width;
-    FDungeonTile &Tile = Grid.GetTile(X, Y);
-
-    // Only calculate for floor tiles
-    if (Tile.Type != ETileType::Floor) {
-      Tile.MonsterSuitability = 0.0f;
-      return;
-    }
-
-    // Query nearby tiles using spatial grid - O(k) where k ≈ 9 cells
-    TArray<FIntPoint> NearbyTiles;
-    SpatialGrid.QueryRadius(X, Y, CheckRadius, NearbyTiles);
-
-    // Count open tiles within radius
-    int32 OpenCount = 0;
-    const FVector2D CenterPos(X + 0.5f, Y + 0.5f);
-
-    for (const FIntPoint &Pt : NearbyTiles) {
-      const FVector2D CheckPos(Pt.X + 0.5f, Pt.Y + 0.5f);
-      const float DistSq = FVector2D::DistSquared(CenterPos, CheckPos);
-
-      if (DistSq <= RadiusSq) {
-        OpenCount++;
-      }
-    }
-
-    // Calculate suitability (0.0 to 1.0)
-    if (NearbyTiles.Num() > 0 && OpenCount >= MinOpenSpace) {
-      const float Ratio = static_cast<float>(OpenCount) / NearbyTiles.Num();
-      const float BonusRatio =
-          static_cast<float>(OpenCount - MinOpenSpace) / MinOpenSpace;
-      Tile.MonsterSuitability =
-          FMath::Clamp(Ratio + BonusRatio * 0.2f, 0.0f, 1.0f);
-    } else {
-      Tile.MonsterSuitability = 0.0f;
-    }
-  });
+  // Shared kernel with DungeonCore: floor summed-area table + disc bands,
+  // row bands run on the task graph. Writes straight into Grid.Tiles.
+  DungeonCore::CoreDungeonGrid CoreGrid = Grid.ViewAsCore();
+  FUnrealExecutorAdapter ExecutorAdapter;
+  DungeonCore::CoreObjectPlacer::CalculateMonsterZones(
+      CoreGrid, CheckRadius, MinOpenSpace, nullptr, &ExecutorAdapter);
 
   UE_LOG(LogTemp, Log,
-         TEXT("CalculateMonsterZones: Optimized calculation completed for "
+         TEXT("CalculateMonsterZones: Summed-area calculation completed for "
               "%dx%d grid"),
          Grid.Width, Grid.Height);
 }
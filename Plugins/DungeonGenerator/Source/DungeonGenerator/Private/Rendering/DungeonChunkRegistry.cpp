@@ -0,0 +1,186 @@
+#include "Rendering/DungeonChunkRegistry.h"
+#include "Components/DynamicMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+void FDungeonChunkRegistry::Reset() {
+  Records.Reset();
+  IndexByCoord.Reset();
+  bIndexDirty = false;
+}
+
+void FDungeonChunkRegistry::EnsureIndex() const {
+  // 개수만으로는 같은 수의 다른 좌표로 바뀐 경우를 놓치므로 플래그로 판단
+  if (!bIndexDirty) {
+    return;
+  }
+  bIndexDirty = false;
+
+  IndexByCoord.Reset();
+  IndexByCoord.Reserve(Records.Num());
+  for (int32 i = 0; i < Records.Num(); i++) {
+    IndexByCoord.Add(Records[i].ChunkCoord, i);
+  }
+}
+
+const FDungeonChunkRecord *
+FDungeonChunkRegistry::Find(FIntPoint ChunkCoord) const {
+  EnsureIndex();
+  const int32 *Index = IndexByCoord.Find(ChunkCoord);
+  return Index ? &Records[*Index] : nullptr;
+}
+
+FDungeonChunkRecord &FDungeonChunkRegistry::FindOrAdd(FIntPoint ChunkCoord) {
+  EnsureIndex();
+  if (const int32 *Index = IndexByCoord.Find(ChunkCoord)) {
+    return Records[*Index];
+  }
+
+  // 인덱스가 최신이므로 새 항목만 추가 (재구축 불필요)
+  const int32 NewIndex = Records.AddDefaulted();
+  Records[NewIndex].ChunkCoord = ChunkCoord;
+  IndexByCoord.Add(ChunkCoord, NewIndex);
+  return Records[NewIndex];
+}
+
+void FDungeonChunkRegistry::AddWallHISM(
+    FIntPoint ChunkCoord, UHierarchicalInstancedStaticMeshComponent *HISM) {
+  if (!HISM) {
+    return;
+  }
+
+  FDungeonChunkRecord &Record = FindOrAdd(ChunkCoord);
+  Record.WallHISMs.AddUnique(HISM);
+  Record.Bounds += HISM->CalcBounds(HISM->GetComponentTransform()).GetBox();
+}
+
+void FDungeonChunkRegistry::SetMergedMesh(FIntPoint ChunkCoord,
+                                          UDynamicMeshComponent *MergedMesh) {
+  FDungeonChunkRecord &Record = FindOrAdd(ChunkCoord);
+  Record.MergedMesh = MergedMesh;
+  if (MergedMesh) {
+    Record.Bounds +=
+        MergedMesh->CalcBounds(MergedMesh->GetComponentTransform()).GetBox();
+  }
+}
+
+void FDungeonChunkRegistry::ClearWallHISMs() {
+  for (FDungeonChunkRecord &Record : Records) {
+    Record.WallHISMs.Reset();
+  }
+}
+
+void FDungeonChunkRegistry::RemoveInvalid() {
+  for (int32 i = Records.Num() - 1; i >= 0; i--) {
+    FDungeonChunkRecord &Record = Records[i];
+    Record.WallHISMs.RemoveAll(
+        [](const TObjectPtr<UHierarchicalInstancedStaticMeshComponent> &HISM) {
+          return !IsValid(HISM);
+        });
+    if (!IsValid(Record.MergedMesh)) {
+      Record.MergedMesh = nullptr;
+    }
+    if (Record.WallHISMs.Num() == 0 && !Record.MergedMesh) {
+      Records.RemoveAtSwap(i);
+    }
+  }
+
+  // RemoveAtSwap으로 인덱스가 바뀜
+  MarkIndexDirty();
+  EnsureIndex();
+}
+
+void FDungeonChunkRegistry::BuildWallHISMMap(
+    TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent *>>
+        &OutWallHISMs) const {
+  OutWallHISMs.Reset();
+  OutWallHISMs.Reserve(Records.Num());
+
+  for (const FDungeonChunkRecord &Record : Records) {
+    if (Record.WallHISMs.Num() == 0) {
+      continue;
+    }
+    TArray<UHierarchicalInstancedStaticMeshComponent *> &HISMs =
+        OutWallHISMs.Add(Record.ChunkCoord);
+    HISMs.Reserve(Record.WallHISMs.Num());
+    for (UHierarchicalInstancedStaticMeshComponent *HISM : Record.WallHISMs) {
+      HISMs.Add(HISM);
+    }
+  }
+}
+
+void FDungeonChunkRegistry::BuildMergedMeshMap(
+    TMap<FIntPoint, UDynamicMeshComponent *> &OutMergedMeshes) const {
+  OutMergedMeshes.Reset();
+  for (const FDungeonChunkRecord &Record : Records) {
+    if (Record.MergedMesh) {
+      OutMergedMeshes.Add(Record.ChunkCoord, Record.MergedMesh);
+    }
+  }
+}
+
+namespace {
+// "..._C{X}_{Y}[_M{Mask}]" 에서 청크 좌표 추출
+bool ParseLegacyChunkName(const FString &Name, FIntPoint &OutChunk) {
+  const int32 CIndex =
+      Name.Find(TEXT("_C"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+  if (CIndex == INDEX_NONE) {
+    return false;
+  }
+
+  TArray<FString> Parts;
+  Name.Mid(CIndex + 2).ParseIntoArray(Parts, TEXT("_"));
+  if (Parts.Num() < 2 || !Parts[0].IsNumeric() || !Parts[1].IsNumeric()) {
+    return false;
+  }
+  OutChunk = FIntPoint(FCString::Atoi(*Parts[0]), FCString::Atoi(*Parts[1]));
+  return true;
+}
+} // namespace
+
+int32 FDungeonChunkRegistry::MigrateFromComponents(AActor *Owner) {
+  if (!Owner) {
+    return 0;
+  }
+
+  // 벽 HISM: 태그 (ChunkX:/ChunkY:) 우선, 없으면 이름
+  TArray<UHierarchicalInstancedStaticMeshComponent *> AllHISMs;
+  Owner->GetComponents<UHierarchicalInstancedStaticMeshComponent>(AllHISMs);
+  for (UHierarchicalInstancedStaticMeshComponent *HISM : AllHISMs) {
+    if (!IsValid(HISM) || !HISM->GetName().StartsWith(TEXT("Wall_C"))) {
+      continue;
+    }
+
+    FIntPoint ChunkCoord = FIntPoint::ZeroValue;
+    bool bFoundX = false;
+    bool bFoundY = false;
+    for (const FName &Tag : HISM->ComponentTags) {
+      const FString TagStr = Tag.ToString();
+      if (TagStr.StartsWith(TEXT("ChunkX:"))) {
+        ChunkCoord.X = FCString::Atoi(*TagStr.Mid(7));
+        bFoundX = true;
+      } else if (TagStr.StartsWith(TEXT("ChunkY:"))) {
+        ChunkCoord.Y = FCString::Atoi(*TagStr.Mid(7));
+        bFoundY = true;
+      }
+    }
+
+    if ((bFoundX && bFoundY) ||
+        ParseLegacyChunkName(HISM->GetName(), ChunkCoord)) {
+      AddWallHISM(ChunkCoord, HISM);
+    }
+  }
+
+  // 머지 메시: {Prefix}_C{X}_{Y}
+  TArray<UDynamicMeshComponent *> AllMergedMeshes;
+  Owner->GetComponents<UDynamicMeshComponent>(AllMergedMeshes);
+  for (UDynamicMeshComponent *Mesh : AllMergedMeshes) {
+    FIntPoint ChunkCoord = FIntPoint::ZeroValue;
+    if (IsValid(Mesh) && Mesh->GetName().StartsWith(TEXT("Merged")) &&
+        ParseLegacyChunkName(Mesh->GetName(), ChunkCoord)) {
+      SetMergedMesh(ChunkCoord, Mesh);
+    }
+  }
+
+  return Records.Num();
+}
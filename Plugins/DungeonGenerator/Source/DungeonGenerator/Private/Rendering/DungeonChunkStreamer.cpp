@@ -1,12 +1,39 @@
 #include "Rendering/DungeonChunkStreamer.h"
+#include "Rendering/DungeonChunkRegistry.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 
+namespace {
+// 대기열이 비었을 때의 tick 주기 (실제 업데이트는 UpdateInterval 사용).
+// 대기열이 남아 있으면 매 프레임 tick하며 예산만큼 처리
+constexpr float IdleTickInterval = 0.1f;
+
+// 숨기기는 모든 표시 전환 뒤에 처리
+constexpr float HidePriorityOffset = 1.0e6f;
+
+// 큐 우선순위를 다시 계산하는 카메라 변화량 (청크 단위 이동, 앞 방향 cos)
+constexpr float QueueRebuildDistance = 0.5f;
+constexpr float QueueRebuildFacingDot = 0.9f;
+
+// 우선순위 오름차순, 동점은 좌표순 (결정적)
+bool TransitionBefore(const TPair<float, FIntPoint> &A,
+                      const TPair<float, FIntPoint> &B) {
+  if (A.Key != B.Key) {
+    return A.Key < B.Key;
+  }
+  return A.Value.Y != B.Value.Y ? A.Value.Y < B.Value.Y
+                                : A.Value.X < B.Value.X;
+}
+} // namespace
+
 UDungeonChunkStreamer::UDungeonChunkStreamer() {
   PrimaryComponentTick.bCanEverTick = true;
-  PrimaryComponentTick.TickInterval =
-      0.1f; // 기본 tick은 빠르게, 실제 업데이트는 UpdateInterval 사용
+  PrimaryComponentTick.TickInterval = IdleTickInterval;
+
+  // 렌더는 앞쪽 먼저, 콜리전은 플레이어 주변이 중요하므로 거리순
+  VisibilityQueue.FacingWeight = 0.5f;
+  CollisionQueue.FacingWeight = 0.0f;
 }
 
 void UDungeonChunkStreamer::BeginPlay() {
@@ -26,25 +53,126 @@ void UDungeonChunkStreamer::TickComponent(
     FActorComponentTickFunction *ThisTickFunction) {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-  if (!bEnableStreaming) {
+  // 스트리밍이 꺼져 있어도 외부에서 예약한 전환은 마저 처리
+  if (!bEnableStreaming && GetPendingTransitionCount() == 0) {
     return;
   }
 
   // 업데이트 주기 확인
   float CurrentTime = GetWorld()->GetTimeSeconds();
-  if (CurrentTime - LastUpdateTime < UpdateInterval) {
-    return;
+  if (bEnableStreaming && CurrentTime - LastUpdateTime >= UpdateInterval) {
+    LastUpdateTime = CurrentTime;
+
+    // 카메라 위치 기반 청크 업데이트 (전환은 예약만)
+    FVector CameraLocation = GetCameraLocation();
+    UpdateActiveChunks(CameraLocation);
+    UnregisterStaleHiddenChunks(CurrentTime);
+  }
+
+  if (GetPendingTransitionCount() > 0) {
+    const FVector2D Forward = FVector2D(GetCameraForward()).GetSafeNormal();
+    if (!Forward.IsZero()) {
+      PriorityCameraForward = Forward;
+    }
+    ProcessPendingTransitions();
+  }
+
+  // 대기열이 남아 있으면 매 프레임, 비었으면 느슨하게
+  const float DesiredInterval =
+      GetPendingTransitionCount() > 0 ? 0.0f : IdleTickInterval;
+  if (GetComponentTickInterval() != DesiredInterval) {
+    SetComponentTickInterval(DesiredInterval);
+  }
+}
+
+namespace {
+// 원형 창 행별 반폭: 반경 Radius(실수) 원 안의 |DX| 최대값
+void BuildHalfWidths(float Radius, TArray<int32> &OutHalfWidths) {
+  const int32 MaxDY = FMath::FloorToInt(Radius);
+  OutHalfWidths.SetNumUninitialized(MaxDY * 2 + 1);
+  for (int32 DY = -MaxDY; DY <= MaxDY; DY++) {
+    OutHalfWidths[DY + MaxDY] =
+        FMath::FloorToInt(FMath::Sqrt(Radius * Radius - (float)(DY * DY)));
+  }
+}
+
+// Center 원 안의 청크 중 Excluded 원(같은 반폭) 밖에 있는 것만 방문
+// (Excluded가 없으면 원 전체). 카메라가 한 칸 움직이면 행마다 끝 몇 칸만 남음
+template <typename FuncType>
+void ForEachInSpanDifference(const TArray<int32> &HalfWidths, FIntPoint Center,
+                             const FIntPoint *Excluded, FuncType &&Func) {
+  const int32 MaxDY = HalfWidths.Num() / 2;
+  for (int32 DY = -MaxDY; DY <= MaxDY; DY++) {
+    const int32 Y = Center.Y + DY;
+    const int32 HalfWidth = HalfWidths[DY + MaxDY];
+
+    // 같은 행에서 Excluded 원이 덮는 구간 (없으면 빈 구간)
+    int32 SkipMin = 1;
+    int32 SkipMax = 0;
+    const int32 ExcludedDY = Excluded ? Y - Excluded->Y : MAX_int32;
+    if (FMath::Abs(ExcludedDY) <= MaxDY) {
+      const int32 ExcludedHalfWidth = HalfWidths[ExcludedDY + MaxDY];
+      SkipMin = Excluded->X - ExcludedHalfWidth;
+      SkipMax = Excluded->X + ExcludedHalfWidth;
+    }
+
+    for (int32 X = Center.X - HalfWidth; X <= Center.X + HalfWidth; X++) {
+      if (X >= SkipMin && X <= SkipMax) {
+        X = SkipMax;
+        continue;
+      }
+      Func(FIntPoint(X, Y));
+    }
+  }
+}
+} // namespace
+
+bool UDungeonChunkStreamer::RebuildWindowSpans() {
+  if (CachedStreamingDistance == StreamingDistance &&
+      CachedHysteresis == StreamingHysteresis) {
+    return false;
+  }
+  CachedStreamingDistance = StreamingDistance;
+  CachedHysteresis = StreamingHysteresis;
+
+  // 청크 중심 간 거리 기준. +0.5로 축 방향 끝 청크까지 포함
+  // (정사각형 (2R+1)^2 대비 약 20~25% 적은 청크)
+  const float EnterRadius = FMath::Max(StreamingDistance, 0) + 0.5f;
+  const float LeaveRadius =
+      EnterRadius + FMath::Max(StreamingHysteresis, 0.0f);
+  BuildHalfWidths(EnterRadius, EnterHalfWidths);
+  BuildHalfWidths(LeaveRadius, LeaveHalfWidths);
+  return true;
+}
+
+void UDungeonChunkStreamer::ResyncActiveChunks() {
+  // 이탈 원 밖 청크 숨김
+  const int32 MaxDY = LeaveHalfWidths.Num() / 2;
+  for (auto It = ActiveChunks.CreateIterator(); It; ++It) {
+    const FIntPoint Offset = *It - StreamingCenter;
+    if (FMath::Abs(Offset.Y) > MaxDY ||
+        FMath::Abs(Offset.X) > LeaveHalfWidths[Offset.Y + MaxDY]) {
+      RequestChunkVisible(*It, false);
+      It.RemoveCurrent();
+    }
   }
-  LastUpdateTime = CurrentTime;
 
-  // 카메라 위치 기반 청크 업데이트
-  FVector CameraLocation = GetCameraLocation();
-  UpdateActiveChunks(CameraLocation);
+  // 진입 원 안 청크 표시
+  ForEachInSpanDifference(EnterHalfWidths, StreamingCenter, nullptr,
+                          [this](FIntPoint Chunk) {
+                            bool bAlreadyActive = false;
+                            ActiveChunks.Add(Chunk, &bAlreadyActive);
+                            if (!bAlreadyActive) {
+                              RequestChunkVisible(Chunk, true);
+                            }
+                          });
 }
 
 void UDungeonChunkStreamer::UpdateActiveChunks(const FVector &CameraLocation) {
   // 카메라 위치를 청크 좌표로 변환
   FIntPoint CameraChunk = WorldToChunkCoord(CameraLocation);
+  PriorityCameraPosition = WorldToChunkPosition(CameraLocation);
+  const bool bSettingsChanged = RebuildWindowSpans();
 
   // 청크맵 상태 로그 (디버그용)
   // UE_LOG(LogTemp, Log, TEXT("DungeonChunkStreamer: Camera at chunk (%d, %d),
@@ -52,30 +180,30 @@ void UDungeonChunkStreamer::UpdateActiveChunks(const FVector &CameraLocation) {
   // ChunkHISMMap.Num());
 
   // [FIXED] First Run Check: 첫 실행 시 모든 청크를 숨기고 카메라 주변만 활성화
-  if (ActiveChunks.Num() == 0 &&
-      (ChunkHISMMap.Num() > 0 || ChunkMergedMeshMap.Num() > 0)) {
+  if (!bHasStreamingCenter) {
+    if (ChunkHISMMap.Num() == 0 && ChunkMergedMeshMap.Num() == 0) {
+      return;
+    }
 
     UE_LOG(LogTemp, Warning,
            TEXT("[DungeonChunkStreamer] First Run: Initializing streaming with "
                 "%d chunks"),
            ChunkHISMMap.Num());
 
-    // 1. 먼저 모든 청크를 숨김 (초기 상태 정리)
+    // 1. 먼저 모든 청크를 숨김 (초기 상태 정리, 예약만 하고 주변 청크
+    // 표시가 끝난 뒤 예산 안에서 처리)
     for (const auto &Pair : ChunkHISMMap) {
-      SetChunkVisible(Pair.Key, false);
+      RequestChunkVisible(Pair.Key, false);
     }
     for (const auto &Pair : ChunkMergedMeshMap) {
-      SetChunkVisible(Pair.Key, false);
+      RequestChunkVisible(Pair.Key, false);
     }
+    ActiveChunks.Reset();
 
-    // 2. 카메라 주변 청크만 활성화
-    for (int32 Y = -StreamingDistance; Y <= StreamingDistance; Y++) {
-      for (int32 X = -StreamingDistance; X <= StreamingDistance; X++) {
-        FIntPoint ChunkCoord = CameraChunk + FIntPoint(X, Y);
-        SetChunkVisible(ChunkCoord, true);
-        ActiveChunks.Add(ChunkCoord);
-      }
-    }
+    // 2. 카메라 주변 (진입 원) 청크만 활성화
+    StreamingCenter = CameraChunk;
+    bHasStreamingCenter = true;
+    ResyncActiveChunks();
 
     UE_LOG(LogTemp, Warning,
            TEXT("[DungeonChunkStreamer] First Run complete: %d chunks active "
@@ -85,35 +213,90 @@ void UDungeonChunkStreamer::UpdateActiveChunks(const FVector &CameraLocation) {
     return; // 첫 실행 완료, 일반 로직 건너뛰기
   }
 
-  // 새롭게 활성화할 청크 계산
-  TSet<FIntPoint> NewActiveChunks;
-  for (int32 Y = -StreamingDistance; Y <= StreamingDistance; Y++) {
-    for (int32 X = -StreamingDistance; X <= StreamingDistance; X++) {
-      FIntPoint ChunkCoord = CameraChunk + FIntPoint(X, Y);
-      NewActiveChunks.Add(ChunkCoord);
-    }
+  // 설정이 바뀌면 불변식(활성 ⊆ 이탈 원, 진입 원 ⊆ 활성)이 깨지므로 전체 재계산
+  if (bSettingsChanged) {
+    StreamingCenter = CameraChunk;
+    ResyncActiveChunks();
+    return;
   }
 
-  // 비활성화할 청크 (이전에 활성이었으나 새 범위에 없는 것)
-  for (const FIntPoint &Chunk : ActiveChunks) {
-    if (!NewActiveChunks.Contains(Chunk)) {
-      SetChunkVisible(Chunk, false);
-    }
+  // 같은 청크 안에서 움직이면 할 일 없음
+  if (CameraChunk == StreamingCenter) {
+    return;
   }
+  const FIntPoint OldCenter = StreamingCenter;
+  StreamingCenter = CameraChunk;
+
+  // 비활성화: 활성 청크는 모두 이전 이탈 원 안에 있으므로
+  // (이전 이탈 원 - 새 이탈 원) 띠만 확인
+  ForEachInSpanDifference(LeaveHalfWidths, OldCenter, &CameraChunk,
+                          [this](FIntPoint Chunk) {
+                            if (ActiveChunks.Remove(Chunk) > 0) {
+                              RequestChunkVisible(Chunk, false);
+                            }
+                          });
+
+  // 활성화: 이전 진입 원 안은 이미 활성이므로 (새 진입 원 - 이전 진입 원)
+  // 띠만 확인
+  ForEachInSpanDifference(EnterHalfWidths, CameraChunk, &OldCenter,
+                          [this](FIntPoint Chunk) {
+                            bool bAlreadyActive = false;
+                            ActiveChunks.Add(Chunk, &bAlreadyActive);
+                            if (!bAlreadyActive) {
+                              RequestChunkVisible(Chunk, true);
+                            }
+                          });
+}
 
-  // 활성화할 청크 (새 범위에 있으나 이전에 비활성이었던 것)
-  for (const FIntPoint &Chunk : NewActiveChunks) {
-    if (!ActiveChunks.Contains(Chunk)) {
-      SetChunkVisible(Chunk, true);
+template <typename FuncType>
+void UDungeonChunkStreamer::ForEachChunkComponent(FIntPoint ChunkCoord,
+                                                  FuncType &&Func) const {
+  if (const TArray<UHierarchicalInstancedStaticMeshComponent *> *HISMs =
+          ChunkHISMMap.Find(ChunkCoord)) {
+    for (UHierarchicalInstancedStaticMeshComponent *HISM : *HISMs) {
+      if (IsValid(HISM)) {
+        Func(HISM);
+      }
+    }
+  }
+  if (UDynamicMeshComponent *const *MergedMesh =
+          ChunkMergedMeshMap.Find(ChunkCoord)) {
+    if (IsValid(*MergedMesh)) {
+      Func(*MergedMesh);
     }
   }
-
-  ActiveChunks = NewActiveChunks;
 }
 
 void UDungeonChunkStreamer::SetChunkVisible(FIntPoint ChunkCoord,
                                             bool bVisible) {
-  int32 AffectedHISMCount = 0;
+  // 즉시 적용이므로 같은 청크의 예약은 취소
+  PendingVisibility.Remove(ChunkCoord);
+  PendingCollision.Remove(ChunkCoord);
+
+  ApplyChunkRendering(ChunkCoord, bVisible);
+  ApplyChunkCollision(ChunkCoord, bVisible);
+}
+
+void UDungeonChunkStreamer::RequestChunkVisible(FIntPoint ChunkCoord,
+                                                bool bVisible) {
+  EnqueueTransition(PendingVisibility, VisibilityQueue, ChunkCoord, bVisible);
+}
+
+void UDungeonChunkStreamer::ApplyChunkRendering(FIntPoint ChunkCoord,
+                                                bool bVisible) {
+  if (bVisible) {
+    HiddenSinceTimes.Remove(ChunkCoord);
+    // 오래 숨겨져 등록 해제된 청크는 다시 등록 (렌더/물리 상태 재생성)
+    if (UnregisteredChunks.Remove(ChunkCoord) > 0) {
+      ForEachChunkComponent(ChunkCoord, [](UPrimitiveComponent *Component) {
+        if (!Component->IsRegistered()) {
+          Component->RegisterComponent();
+        }
+      });
+    }
+  } else if (UWorld *World = GetWorld()) {
+    HiddenSinceTimes.Add(ChunkCoord, World->GetTimeSeconds());
+  }
 
   // 벽 HISM들
   if (TArray<UHierarchicalInstancedStaticMeshComponent *> *HISMs =
@@ -122,20 +305,8 @@ void UDungeonChunkStreamer::SetChunkVisible(FIntPoint ChunkCoord,
       if (HISM && IsValid(HISM)) {
         HISM->SetVisibility(bVisible, true);
         HISM->SetHiddenInGame(!bVisible, true); // 추가: HiddenInGame도 설정
-        // 콜리전도 함께 제어 (성능 최적화)
-        HISM->SetCollisionEnabled(bVisible ? ECollisionEnabled::QueryAndPhysics
-                                           : ECollisionEnabled::NoCollision);
-        AffectedHISMCount++;
       }
     }
-
-    // UE_LOG(LogTemp, Warning, TEXT("SetChunkVisible: Chunk (%d,%d) -> %s,
-    // affected %d HISMs out of %d"), 	ChunkCoord.X, ChunkCoord.Y, 	bVisible
-    // ?
-    // TEXT("SHOW") : TEXT("HIDE"), 	AffectedHISMCount, HISMs->Num());
-  } else {
-    // UE_LOG(LogTemp, Warning, TEXT("SetChunkVisible: Chunk (%d,%d) NOT FOUND
-    // in ChunkHISMMap!"), 	ChunkCoord.X, ChunkCoord.Y);
   }
 
   // 머지된 메시
@@ -143,38 +314,175 @@ void UDungeonChunkStreamer::SetChunkVisible(FIntPoint ChunkCoord,
           ChunkMergedMeshMap.Find(ChunkCoord)) {
     if (*MergedMesh) {
       (*MergedMesh)->SetVisibility(bVisible, true);
-      (*MergedMesh)
-          ->SetCollisionEnabled(bVisible ? ECollisionEnabled::QueryAndPhysics
-                                         : ECollisionEnabled::NoCollision);
     }
   }
+}
+
+void UDungeonChunkStreamer::ApplyChunkCollision(FIntPoint ChunkCoord,
+                                                bool bVisible) {
+  const ECollisionEnabled::Type Collision =
+      bVisible ? ECollisionEnabled::QueryAndPhysics
+               : ECollisionEnabled::NoCollision;
 
-  // 바닥
-  if (UHierarchicalInstancedStaticMeshComponent **Floor =
-          ChunkFloorMap.Find(ChunkCoord)) {
-    if (*Floor) {
-      (*Floor)->SetVisibility(bVisible, true);
+  // 벽 HISM들 (콜리전도 함께 제어, 성능 최적화)
+  if (TArray<UHierarchicalInstancedStaticMeshComponent *> *HISMs =
+          ChunkHISMMap.Find(ChunkCoord)) {
+    for (UHierarchicalInstancedStaticMeshComponent *HISM : *HISMs) {
+      if (HISM && IsValid(HISM)) {
+        HISM->SetCollisionEnabled(Collision);
+      }
     }
   }
 
-  // 천장
-  if (UHierarchicalInstancedStaticMeshComponent **Ceiling =
-          ChunkCeilingMap.Find(ChunkCoord)) {
-    if (*Ceiling) {
-      (*Ceiling)->SetVisibility(bVisible, true);
+  // 머지된 메시
+  if (UDynamicMeshComponent **MergedMesh =
+          ChunkMergedMeshMap.Find(ChunkCoord)) {
+    if (*MergedMesh) {
+      (*MergedMesh)->SetCollisionEnabled(Collision);
     }
   }
+}
 
-  if (bVisible) {
-    // UE_LOG(LogTemp, Log, TEXT("DungeonChunkStreamer: Chunk (%d, %d)
-    // activated"), ChunkCoord.X, ChunkCoord.Y);
+float UDungeonChunkStreamer::GetTransitionPriority(
+    const FTransitionQueue &Queue, FIntPoint ChunkCoord, bool bVisible) const {
+  // 카메라에서 가까울수록, 앞쪽일수록 먼저 (FacingWeight만큼 앞은 거리를
+  // 줄이고 뒤는 늘림). 숨기기는 표시 뒤로
+  const FVector2D Delta(ChunkCoord.X + 0.5f - Queue.BuiltCameraPosition.X,
+                        ChunkCoord.Y + 0.5f - Queue.BuiltCameraPosition.Y);
+  const float Distance = Delta.Size();
+  const float Facing =
+      Distance > KINDA_SMALL_NUMBER
+          ? FVector2D::DotProduct(Delta / Distance, Queue.BuiltCameraForward)
+          : 1.0f;
+  float Priority = Distance * (1.0f - Queue.FacingWeight * Facing);
+  if (!bVisible) {
+    Priority += HidePriorityOffset;
+  }
+  return Priority;
+}
+
+void UDungeonChunkStreamer::EnqueueTransition(TMap<FIntPoint, bool> &Pending,
+                                              FTransitionQueue &Queue,
+                                              FIntPoint ChunkCoord,
+                                              bool bVisible) {
+  if (bool *Existing = Pending.Find(ChunkCoord)) {
+    if (*Existing == bVisible) {
+      return;
+    }
+    // 이전 힙 항목은 남겨 둠 (꺼낼 때 Pending에 없으면 건너뜀)
+    *Existing = bVisible;
   } else {
-    // UE_LOG(LogTemp, Log, TEXT("DungeonChunkStreamer: Chunk (%d, %d)
-    // deactivated"), ChunkCoord.X, ChunkCoord.Y);
+    Pending.Add(ChunkCoord, bVisible);
+  }
+  Queue.Heap.HeapPush(
+      MakeTuple(GetTransitionPriority(Queue, ChunkCoord, bVisible), ChunkCoord),
+      TransitionBefore);
+}
+
+void UDungeonChunkStreamer::RefreshTransitionQueue(
+    FTransitionQueue &Queue, const TMap<FIntPoint, bool> &Pending) {
+  const bool bCameraMoved =
+      FVector2D::DistSquared(Queue.BuiltCameraPosition,
+                             PriorityCameraPosition) >
+      QueueRebuildDistance * QueueRebuildDistance;
+  const bool bCameraTurned =
+      Queue.FacingWeight > 0.0f &&
+      FVector2D::DotProduct(Queue.BuiltCameraForward, PriorityCameraForward) <
+          QueueRebuildFacingDot;
+  // 취소/덮어쓴 예약의 무효 항목이 쌓이면 정리
+  const bool bTooManyStale = Queue.Heap.Num() > Pending.Num() * 2 + 16;
+  if (!bCameraMoved && !bCameraTurned && !bTooManyStale) {
+    return;
+  }
+
+  // O(N) 힙 구성 (정렬 없음)
+  Queue.BuiltCameraPosition = PriorityCameraPosition;
+  Queue.BuiltCameraForward = PriorityCameraForward;
+  Queue.Heap.Reset(Pending.Num());
+  for (const auto &Pair : Pending) {
+    Queue.Heap.Emplace(GetTransitionPriority(Queue, Pair.Key, Pair.Value),
+                       Pair.Key);
+  }
+  Queue.Heap.Heapify(TransitionBefore);
+}
+
+void UDungeonChunkStreamer::ProcessPendingTransitions() {
+  // 큐 재구성도 각 단계 예산에 포함. 최소 1개는 처리해 대기열이 항상
+  // 줄어들게 함
+  auto DrainQueue = [this](TMap<FIntPoint, bool> &Pending,
+                           FTransitionQueue &Queue, float BudgetMs,
+                           auto &&Apply) {
+    const double Deadline = FPlatformTime::Seconds() + BudgetMs * 0.001;
+    RefreshTransitionQueue(Queue, Pending);
+
+    bool bProcessedAny = false;
+    TPair<float, FIntPoint> Entry;
+    while (Queue.Heap.Num() > 0) {
+      if (bProcessedAny && FPlatformTime::Seconds() >= Deadline) {
+        break;
+      }
+      Queue.Heap.HeapPop(Entry, TransitionBefore, EAllowShrinking::No);
+      bool bVisible = false;
+      if (!Pending.RemoveAndCopyValue(Entry.Value, bVisible)) {
+        continue; // 이미 처리되었거나 취소된 예약
+      }
+      Apply(Entry.Value, bVisible);
+      bProcessedAny = true;
+    }
+  };
+
+  // 1. 렌더 전환 (컴포넌트마다 렌더 상태 재생성이 일어나므로 예산 제한)
+  if (PendingVisibility.Num() > 0) {
+    DrainQueue(PendingVisibility, VisibilityQueue, VisibilityBudgetMs,
+               [this](FIntPoint ChunkCoord, bool bVisible) {
+                 ApplyChunkRendering(ChunkCoord, bVisible);
+                 // 콜리전은 별도 대기열에서 (물리 상태 재생성은 다음 단계
+                 // 예산으로)
+                 EnqueueTransition(PendingCollision, CollisionQueue,
+                                   ChunkCoord, bVisible);
+               });
+  }
+
+  // 2. 콜리전 전환
+  if (PendingCollision.Num() > 0) {
+    DrainQueue(PendingCollision, CollisionQueue, CollisionBudgetMs,
+               [this](FIntPoint ChunkCoord, bool bVisible) {
+                 ApplyChunkCollision(ChunkCoord, bVisible);
+               });
+  }
+}
+
+void UDungeonChunkStreamer::UnregisterStaleHiddenChunks(double CurrentTime) {
+  if (UnregisterHiddenAfter <= 0.0f) {
+    return;
+  }
+
+  for (auto It = HiddenSinceTimes.CreateIterator(); It; ++It) {
+    // 아직 전환 대기 중이면 (다시 보일 수 있음) 보류
+    if (CurrentTime - It.Value() < UnregisterHiddenAfter ||
+        PendingVisibility.Contains(It.Key()) ||
+        PendingCollision.Contains(It.Key())) {
+      continue;
+    }
+
+    // 등록 해제: 렌더/물리 상태를 완전히 내려 숨긴 컴포넌트 비용 제거
+    ForEachChunkComponent(It.Key(), [](UPrimitiveComponent *Component) {
+      if (Component->IsRegistered()) {
+        Component->UnregisterComponent();
+      }
+    });
+    UnregisteredChunks.Add(It.Key());
+    It.RemoveCurrent();
   }
 }
 
 void UDungeonChunkStreamer::ShowAllChunks() {
+  // 즉시 전부 표시하므로 남은 예약은 버림
+  PendingVisibility.Empty();
+  PendingCollision.Empty();
+  VisibilityQueue.Heap.Empty();
+  CollisionQueue.Heap.Empty();
+
   for (auto &Pair : ChunkHISMMap) {
     SetChunkVisible(Pair.Key, true);
     ActiveChunks.Add(Pair.Key);
@@ -192,15 +500,49 @@ void UDungeonChunkStreamer::ShowAllChunks() {
 }
 
 void UDungeonChunkStreamer::ClearChunkData() {
+  // 스트리밍이 숨기거나 등록 해제한 컴포넌트는 원래 상태로 되돌린 뒤 잊음
+  // (맵에서 빠지면 다시 등록/표시할 곳이 없음)
+  TSet<FIntPoint> TouchedChunks = UnregisteredChunks;
+  for (const auto &Pair : HiddenSinceTimes) {
+    TouchedChunks.Add(Pair.Key);
+  }
+  for (const auto &Pair : PendingVisibility) {
+    TouchedChunks.Add(Pair.Key);
+  }
+  for (const auto &Pair : PendingCollision) {
+    TouchedChunks.Add(Pair.Key);
+  }
+  for (const FIntPoint &Chunk : TouchedChunks) {
+    ForEachChunkComponent(Chunk, [](UPrimitiveComponent *Component) {
+      if (!Component->IsRegistered()) {
+        Component->RegisterComponent();
+      }
+      Component->SetVisibility(true, true);
+      Component->SetHiddenInGame(false, true);
+      Component->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    });
+  }
+
   ChunkHISMMap.Empty();
   ChunkMergedMeshMap.Empty();
-  ChunkFloorMap.Empty();
-  ChunkCeilingMap.Empty();
   ActiveChunks.Empty();
+  bHasStreamingCenter = false;
+  PendingVisibility.Empty();
+  PendingCollision.Empty();
+  VisibilityQueue.Heap.Empty();
+  CollisionQueue.Heap.Empty();
+  HiddenSinceTimes.Empty();
+  UnregisteredChunks.Empty();
 }
 
-FIntPoint
-UDungeonChunkStreamer::WorldToChunkCoord(const FVector &WorldLocation) const {
+void UDungeonChunkStreamer::ApplyChunkRegistry(
+    const FDungeonChunkRegistry &Registry) {
+  Registry.BuildWallHISMMap(ChunkHISMMap);
+  Registry.BuildMergedMeshMap(ChunkMergedMeshMap);
+}
+
+FVector2D UDungeonChunkStreamer::WorldToChunkPosition(
+    const FVector &WorldLocation) const {
   // 액터의 로컬 오프셋 고려
   FVector LocalLocation = WorldLocation;
   if (AActor *Owner = GetOwner()) {
@@ -208,8 +550,15 @@ UDungeonChunkStreamer::WorldToChunkCoord(const FVector &WorldLocation) const {
   }
 
   float ChunkWorldSize = TileSize * ChunkSize;
-  return FIntPoint(FMath::FloorToInt(LocalLocation.X / ChunkWorldSize),
-                   FMath::FloorToInt(LocalLocation.Y / ChunkWorldSize));
+  return FVector2D(LocalLocation.X / ChunkWorldSize,
+                   LocalLocation.Y / ChunkWorldSize);
+}
+
+FIntPoint
+UDungeonChunkStreamer::WorldToChunkCoord(const FVector &WorldLocation) const {
+  const FVector2D ChunkPosition = WorldToChunkPosition(WorldLocation);
+  return FIntPoint(FMath::FloorToInt(ChunkPosition.X),
+                   FMath::FloorToInt(ChunkPosition.Y));
 }
 
 FVector UDungeonChunkStreamer::GetCameraLocation() const {
@@ -232,3 +581,17 @@ FVector UDungeonChunkStreamer::GetCameraLocation() const {
 
   return FVector::ZeroVector;
 }
+
+FVector UDungeonChunkStreamer::GetCameraForward() const {
+  if (UWorld *World = GetWorld()) {
+    if (APlayerController *PC = World->GetFirstPlayerController()) {
+      if (APlayerCameraManager *CameraManager = PC->PlayerCameraManager) {
+        return CameraManager->GetCameraRotation().Vector();
+      }
+      if (APawn *Pawn = PC->GetPawn()) {
+        return Pawn->GetActorForwardVector();
+      }
+    }
+  }
+  return FVector::ForwardVector;
+}
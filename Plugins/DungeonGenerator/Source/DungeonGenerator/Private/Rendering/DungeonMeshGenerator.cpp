@@ -1,4 +1,315 @@
 ﻿#include "Rendering/DungeonMeshGenerator.h"
+#include "Async/ParallelFor.h"
+
+namespace {
+// 셀 로컬 점 ID: 코너 0~3, 엣지 보간점 4~7
+enum ECellPoint : uint8 {
+  CP_BL,
+  CP_BR,
+  CP_TR,
+  CP_TL,
+  CP_Bot,
+  CP_Right,
+  CP_Top,
+  CP_Left,
+  CP_None = 0xFF
+};
+
+// 점 ID -> 격자 좌표 오프셋 (dx, dy) 와 종류 (0=코너, 1=가로 엣지, 2=세로 엣지)
+constexpr int32 PointLattice[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0},
+                                      {0, 1, 0}, {0, 0, 1}, {1, 0, 2},
+                                      {0, 1, 1}, {0, 0, 2}};
+
+struct FCellPolygon {
+  int32 Num;
+  uint8 Points[6];
+};
+
+// 구성별 벽 영역 다각형 (XY 반시계 = 위에서 보이는 방향, 모두 볼록)
+// 셀 변 위의 구간이 이웃 셀과 정확히 겹치므로 윤곽선 점마다 측면이 둘씩만
+// 만남. 안장(5, 10)은 벽끼리 잇는 육각형. 15는 지오메트리 없이 면 제거
+// 판정에만 사용
+constexpr FCellPolygon CellPolygons[16] = {
+    {0, {}},                                                // 0: 빈 셀
+    {3, {CP_BL, CP_Bot, CP_Left}},                          // 1: ◣
+    {3, {CP_BR, CP_Right, CP_Bot}},                         // 2: ◢
+    {4, {CP_BL, CP_BR, CP_Right, CP_Left}},                 // 3: ▬
+    {3, {CP_TR, CP_Top, CP_Right}},                         // 4: ◥
+    {6, {CP_BL, CP_Bot, CP_Right, CP_TR, CP_Top, CP_Left}}, // 5
+    {4, {CP_BR, CP_TR, CP_Top, CP_Bot}},                    // 6: ▐
+    {5, {CP_BL, CP_BR, CP_TR, CP_Top, CP_Left}},            // 7
+    {3, {CP_TL, CP_Left, CP_Top}},                          // 8: ◤
+    {4, {CP_BL, CP_Bot, CP_Top, CP_TL}},                    // 9: ▌
+    {6, {CP_BR, CP_Right, CP_Top, CP_TL, CP_Left, CP_Bot}}, // 10
+    {5, {CP_BL, CP_BR, CP_Right, CP_Top, CP_TL}},           // 11
+    {4, {CP_Left, CP_Right, CP_TR, CP_TL}},                 // 12: ▀
+    {5, {CP_BL, CP_Bot, CP_Right, CP_TR, CP_TL}},           // 13
+    {5, {CP_BR, CP_TR, CP_TL, CP_Left, CP_Bot}},            // 14
+    {4, {CP_BL, CP_BR, CP_TR, CP_TL}},                      // 15: 꽉 찬 셀
+};
+
+// 셀 변: 0=아래(Y-1), 1=오른쪽(X+1), 2=위(Y+1), 3=왼쪽(X-1)
+constexpr int32 SideOffset[4][2] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+
+// 변 위의 점 -> 이웃 셀에서 같은 위치의 점 (변 위가 아니면 CP_None)
+constexpr uint8 AcrossSide[4][8] = {
+    {CP_TL, CP_TR, CP_None, CP_None, CP_Top, CP_None, CP_None, CP_None},
+    {CP_None, CP_BL, CP_TL, CP_None, CP_None, CP_Left, CP_None, CP_None},
+    {CP_None, CP_None, CP_BR, CP_BL, CP_None, CP_None, CP_Bot, CP_None},
+    {CP_BR, CP_None, CP_None, CP_TR, CP_None, CP_None, CP_None, CP_Right},
+};
+
+bool HasDirectedEdge(uint8 Config, uint8 From, uint8 To) {
+  const FCellPolygon &Polygon = CellPolygons[Config];
+  for (int32 i = 0; i < Polygon.Num; i++) {
+    if (Polygon.Points[i] == From &&
+        Polygon.Points[(i + 1) % Polygon.Num] == To) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// 워커 스레드 공용 입력 (읽기 전용)
+struct FCaveMeshContext {
+  TArray<uint8> Configs; // 셀 (CellsX x CellsY) 구성
+  int32 CellsX = 0;
+  int32 CellsY = 0;
+  float TileSize = 100.0f;
+  float WallHeight = 300.0f;
+  float Smoothing = 0.5f;
+
+  uint8 GetConfig(int32 CellX, int32 CellY) const {
+    if (CellX < 0 || CellY < 0 || CellX >= CellsX || CellY >= CellsY) {
+      return 0;
+    }
+    return Configs[CellY * CellsX + CellX];
+  }
+
+  FVector GetLatticePosition(int32 GX, int32 GY, int32 Kind, float Z) const {
+    const float X = Kind == 1 ? GX + Smoothing : GX;
+    const float Y = Kind == 2 ? GY + Smoothing : GY;
+    return FVector(X * TileSize, Y * TileSize, Z);
+  }
+
+  // 다각형 변 A->B 가 이웃 셀 다각형과 맞닿는 내부 면인지
+  bool IsInteriorEdge(int32 CellX, int32 CellY, uint8 A, uint8 B) const {
+    for (int32 Side = 0; Side < 4; Side++) {
+      const uint8 NeighborA = AcrossSide[Side][A];
+      const uint8 NeighborB = AcrossSide[Side][B];
+      if (NeighborA != CP_None && NeighborB != CP_None) {
+        const uint8 NeighborConfig = GetConfig(CellX + SideOffset[Side][0],
+                                               CellY + SideOffset[Side][1]);
+        return HasDirectedEdge(NeighborConfig, NeighborB, NeighborA);
+      }
+    }
+    return false;
+  }
+};
+
+// 청크 메시 하나의 버퍼
+struct FCaveMeshSection {
+  FIntPoint ChunkCoord = FIntPoint::ZeroValue;
+  TArray<FVector> Vertices;
+  TArray<int32> Triangles;
+  TArray<FVector> Normals;
+  TArray<FVector2D> UVs;
+};
+
+/**
+ * 청크 셀 범위 [X0, X1) x [Y0, Y1) 의 벽 메시 구축
+ * 정점은 격자 점(코너/엣지 보간점) 인덱스 캐시로 청크 안에서 공유하되,
+ * 윗면과 측면은 90도로 꺾이므로 따로 둠 (같은 면 종류끼리만 용접).
+ * 이웃 셀과 맞닿은 측면은 생략. 윗면 노멀은 Up, 측면 노멀은 윤곽선 바깥
+ * 방향을 생성 중에 누적 (청크 밖 한 칸 셀까지 반영해 이음새 방지)
+ */
+void BuildCaveSection(const FCaveMeshContext &Ctx, int32 X0, int32 Y0,
+                      int32 X1, int32 Y1, FCaveMeshSection &Out) {
+  const int32 LatticeW = X1 - X0 + 1;
+  const int32 LatticeH = Y1 - Y0 + 1;
+  const int32 NumSlots = LatticeW * LatticeH * 3;
+
+  // 격자 점 -> 정점 인덱스 (윗면, 측면 위쪽, 측면 아래쪽).
+  // 측면은 윤곽선을 따라 매끄럽게 용접하되, 바깥 방향이 거의 반대인 면
+  // (얇은 벽 양쪽)끼리만 정점을 나눔. 같은 격자 점의 측면 정점은
+  // NextWallVertex로 연결
+  TArray<int32> CapVertices, WallTopVertices, WallBottomVertices;
+  CapVertices.Init(INDEX_NONE, NumSlots);
+  WallTopVertices.Init(INDEX_NONE, NumSlots);
+  WallBottomVertices.Init(INDEX_NONE, NumSlots);
+  TArray<int32> NextWallVertex;
+
+  // 정점을 만든 면의 노멀 (측면 용접 판정, 노멀 폴백)
+  TArray<FVector> GroupNormals;
+
+  auto GetSlot = [&](int32 CellX, int32 CellY, uint8 Point) -> int32 {
+    const int32 LX = CellX + PointLattice[Point][0] - X0;
+    const int32 LY = CellY + PointLattice[Point][1] - Y0;
+    if (LX < 0 || LY < 0 || LX >= LatticeW || LY >= LatticeH) {
+      return INDEX_NONE;
+    }
+    return (LY * LatticeW + LX) * 3 + PointLattice[Point][2];
+  };
+
+  auto AddVertex = [&](int32 CellX, int32 CellY, uint8 Point, float Z,
+                       float V, const FVector &Normal,
+                       const FVector &GroupNormal) {
+    const FVector Position = Ctx.GetLatticePosition(
+        CellX + PointLattice[Point][0], CellY + PointLattice[Point][1],
+        PointLattice[Point][2], Z);
+    const int32 Index = Out.Vertices.Add(Position);
+    Out.Normals.Add(Normal);
+    Out.UVs.Add(FVector2D(0.0f, V));
+    NextWallVertex.Add(INDEX_NONE);
+    GroupNormals.Add(GroupNormal);
+    return Index;
+  };
+
+  auto GetOrAddCapVertex = [&](int32 CellX, int32 CellY, uint8 Point) {
+    int32 &Index = CapVertices[GetSlot(CellX, CellY, Point)];
+    if (Index == INDEX_NONE) {
+      Index = AddVertex(CellX, CellY, Point, Ctx.WallHeight, 1.0f,
+                        FVector::UpVector, FVector::UpVector);
+    }
+    return Index;
+  };
+
+  // 격자 점에서 EdgeNormal과 용접할 측면 정점 (없으면 INDEX_NONE,
+  // OutLast = 연결 목록의 마지막 정점)
+  auto FindWallVertex = [&](const TArray<int32> &Cache, int32 Slot,
+                            const FVector &EdgeNormal, int32 &OutLast) {
+    OutLast = INDEX_NONE;
+    for (int32 Vertex = Cache[Slot]; Vertex != INDEX_NONE;
+         Vertex = NextWallVertex[Vertex]) {
+      if (FVector::DotProduct(GroupNormals[Vertex], EdgeNormal) > -0.5f) {
+        return Vertex;
+      }
+      OutLast = Vertex;
+    }
+    return INDEX_NONE;
+  };
+
+  // 노멀은 0에서 시작해 AccumulateWallNormals에서 누적
+  auto GetOrAddWallVertex = [&](TArray<int32> &Cache, int32 CellX,
+                                int32 CellY, uint8 Point,
+                                const FVector &EdgeNormal, float Z, float V) {
+    const int32 Slot = GetSlot(CellX, CellY, Point);
+    int32 Last = INDEX_NONE;
+    int32 Vertex = FindWallVertex(Cache, Slot, EdgeNormal, Last);
+    if (Vertex == INDEX_NONE) {
+      Vertex = AddVertex(CellX, CellY, Point, Z, V, FVector::ZeroVector,
+                         EdgeNormal);
+      if (Last == INDEX_NONE) {
+        Cache[Slot] = Vertex;
+      } else {
+        NextWallVertex[Last] = Vertex;
+      }
+    }
+    return Vertex;
+  };
+
+  // 바깥쪽 측면 노멀 (반시계 다각형의 오른쪽)
+  auto GetEdgeNormal = [&](int32 CellX, int32 CellY, uint8 A, uint8 B) {
+    const FVector PA = Ctx.GetLatticePosition(CellX + PointLattice[A][0],
+                                              CellY + PointLattice[A][1],
+                                              PointLattice[A][2], 0.0f);
+    const FVector PB = Ctx.GetLatticePosition(CellX + PointLattice[B][0],
+                                              CellY + PointLattice[B][1],
+                                              PointLattice[B][2], 0.0f);
+    const FVector Delta = PB - PA;
+    return FVector(Delta.Y, -Delta.X, 0.0f).GetSafeNormal();
+  };
+
+  // 셀 하나의 윤곽선 노멀을 이미 만든 측면 정점에 누적 (청크 밖 셀 포함)
+  auto AccumulateWallNormals = [&](int32 CellX, int32 CellY,
+                                   const FCellPolygon &Polygon) {
+    for (int32 i = 0; i < Polygon.Num; i++) {
+      const uint8 A = Polygon.Points[i];
+      const uint8 B = Polygon.Points[(i + 1) % Polygon.Num];
+      if (Ctx.IsInteriorEdge(CellX, CellY, A, B)) {
+        continue;
+      }
+
+      const FVector EdgeNormal = GetEdgeNormal(CellX, CellY, A, B);
+      for (const uint8 Point : {A, B}) {
+        const int32 Slot = GetSlot(CellX, CellY, Point);
+        if (Slot == INDEX_NONE) {
+          continue;
+        }
+        for (const TArray<int32> *Cache :
+             {&WallTopVertices, &WallBottomVertices}) {
+          int32 Last = INDEX_NONE;
+          const int32 Vertex = FindWallVertex(*Cache, Slot, EdgeNormal, Last);
+          if (Vertex != INDEX_NONE) {
+            Out.Normals[Vertex] += EdgeNormal;
+          }
+        }
+      }
+    }
+  };
+
+  for (int32 CellY = Y0; CellY < Y1; CellY++) {
+    for (int32 CellX = X0; CellX < X1; CellX++) {
+      const uint8 Config = Ctx.GetConfig(CellX, CellY);
+      if (Config == 0 || Config == 15) // 완전 비어있거나 꽉 찬 케이스
+      {
+        continue;
+      }
+
+      // 윗면 (위에서 보이는 winding)
+      const FCellPolygon &Polygon = CellPolygons[Config];
+      int32 Cap[6];
+      for (int32 i = 0; i < Polygon.Num; i++) {
+        Cap[i] = GetOrAddCapVertex(CellX, CellY, Polygon.Points[i]);
+      }
+      for (int32 i = 1; i + 1 < Polygon.Num; i++) {
+        Out.Triangles.Append({Cap[0], Cap[i], Cap[i + 1]});
+      }
+
+      // 측면: 윤곽선 변만 (이웃 셀 다각형과 맞닿은 변은 내부)
+      for (int32 i = 0; i < Polygon.Num; i++) {
+        const uint8 A = Polygon.Points[i];
+        const uint8 B = Polygon.Points[(i + 1) % Polygon.Num];
+        if (Ctx.IsInteriorEdge(CellX, CellY, A, B)) {
+          continue;
+        }
+
+        const FVector EdgeNormal = GetEdgeNormal(CellX, CellY, A, B);
+        const int32 TopA = GetOrAddWallVertex(WallTopVertices, CellX, CellY, A,
+                                              EdgeNormal, Ctx.WallHeight, 1.0f);
+        const int32 TopB = GetOrAddWallVertex(WallTopVertices, CellX, CellY, B,
+                                              EdgeNormal, Ctx.WallHeight, 1.0f);
+        const int32 BottomA = GetOrAddWallVertex(WallBottomVertices, CellX,
+                                                 CellY, A, EdgeNormal, 0.0f,
+                                                 0.0f);
+        const int32 BottomB = GetOrAddWallVertex(WallBottomVertices, CellX,
+                                                 CellY, B, EdgeNormal, 0.0f,
+                                                 0.0f);
+        Out.Triangles.Append({BottomA, TopB, TopA, BottomA, BottomB, TopB});
+      }
+
+      AccumulateWallNormals(CellX, CellY, Polygon);
+    }
+  }
+
+  // 청크 경계 정점: 바깥 한 칸 셀의 면도 반영 (청크 간 이음새 방지)
+  for (int32 CellY = Y0 - 1; CellY <= Y1; CellY++) {
+    for (int32 CellX = X0 - 1; CellX <= X1; CellX++) {
+      const bool bInside =
+          CellX >= X0 && CellX < X1 && CellY >= Y0 && CellY < Y1;
+      const uint8 Config = Ctx.GetConfig(CellX, CellY);
+      if (!bInside && Config != 0 && Config != 15) {
+        AccumulateWallNormals(CellX, CellY, CellPolygons[Config]);
+      }
+    }
+  }
+
+  for (int32 i = 0; i < Out.Normals.Num(); i++) {
+    Out.Normals[i] =
+        Out.Normals[i].GetSafeNormal(UE_SMALL_NUMBER, GroupNormals[i]);
+  }
+}
+} // namespace
 
 UDungeonMeshGenerator::UDungeonMeshGenerator() {
   TileSize = 100.0f;
@@ -18,44 +329,91 @@ void UDungeonMeshGenerator::GenerateCaveWalls(
     return;
   }
 
-  // 기존 메시 클리어
+  // 기존 메시 클리어 (이전 청크 컴포넌트는 파괴)
   WallMeshComponent->ClearAllMeshSections();
-
-  TArray<FVector> Vertices;
-  TArray<int32> Triangles;
-  TArray<FVector2D> UVs;
-  TArray<FVector> Normals;
-
-  // Marching Squares 적용
-  for (int32 Y = 0; Y < Grid.Height - 1; Y++) {
-    for (int32 X = 0; X < Grid.Width - 1; X++) {
-      uint8 Config = GetMarchingSquareConfig(X, Y, Grid);
-      if (Config > 0 && Config < 15) // 0과 15는 완전 비어있거나 꽉 찬 케이스
-      {
-        GenerateMarchingSquareGeometry(Vertices, Triangles, UVs, Normals, X, Y,
-                                       Config);
-      }
+  for (const auto &Pair : WallChunkComponents) {
+    if (IsValid(Pair.Value)) {
+      Pair.Value->DestroyComponent();
     }
   }
+  WallChunkComponents.Reset();
+
+  // 셀 구성 계산 (행 단위 병렬)
+  FCaveMeshContext Ctx;
+  Ctx.CellsX = FMath::Max(Grid.Width - 1, 0);
+  Ctx.CellsY = FMath::Max(Grid.Height - 1, 0);
+  Ctx.TileSize = TileSize;
+  Ctx.WallHeight = WallHeight;
+  Ctx.Smoothing = CurveSmoothing;
+  Ctx.Configs.SetNumUninitialized(Ctx.CellsX * Ctx.CellsY);
+  ParallelFor(Ctx.CellsY, [this, &Ctx, &Grid](int32 CellY) {
+    for (int32 CellX = 0; CellX < Ctx.CellsX; CellX++) {
+      Ctx.Configs[CellY * Ctx.CellsX + CellX] =
+          GetMarchingSquareConfig(CellX, CellY, Grid);
+    }
+  });
+
+  // Marching Squares: 청크별 병렬 생성
+  const int32 SectionSize = FMath::Max(WallChunkSize, 4);
+  const int32 ChunksX = FMath::DivideAndRoundUp(Ctx.CellsX, SectionSize);
+  const int32 ChunksY = FMath::DivideAndRoundUp(Ctx.CellsY, SectionSize);
+  TArray<FCaveMeshSection> Sections;
+  Sections.SetNum(ChunksX * ChunksY);
+
+  ParallelFor(Sections.Num(), [&](int32 SectionIndex) {
+    const int32 ChunkX = SectionIndex % ChunksX;
+    const int32 ChunkY = SectionIndex / ChunksX;
+    FCaveMeshSection &Section = Sections[SectionIndex];
+    Section.ChunkCoord = FIntPoint(ChunkX, ChunkY);
+    BuildCaveSection(Ctx, ChunkX * SectionSize, ChunkY * SectionSize,
+                     FMath::Min((ChunkX + 1) * SectionSize, Ctx.CellsX),
+                     FMath::Min((ChunkY + 1) * SectionSize, Ctx.CellsY),
+                     Section);
+  });
+
+  // 컴포넌트 생성 (비어 있지 않은 청크만). 컴포넌트마다 바운드가 따로라
+  // 화면 밖 청크는 렌더/콜리전 쿼리에서 빠짐
+  UObject *Outer = WallMeshComponent->GetOwner();
+  if (!Outer) {
+    Outer = WallMeshComponent->GetOuter();
+  }
+  int32 TotalVertices = 0;
+  for (FCaveMeshSection &Section : Sections) {
+    if (Section.Vertices.Num() == 0) {
+      continue;
+    }
 
-  // 노멀 스무딩
-  ApplySmoothNormals(Normals, Vertices, Triangles);
-
-  // 메시 생성
-  if (Vertices.Num() > 0) {
-    TArray<FColor> VertexColors;
-    TArray<FProcMeshTangent> Tangents;
-
-    WallMeshComponent->CreateMeshSection(0, Vertices, Triangles, Normals, UVs,
-                                         VertexColors, Tangents, true);
-
+    const FString BaseName = FString::Printf(
+        TEXT("CaveWall_C%d_%d"), Section.ChunkCoord.X, Section.ChunkCoord.Y);
+    UProceduralMeshComponent *ChunkMesh = NewObject<UProceduralMeshComponent>(
+        Outer, UProceduralMeshComponent::StaticClass(),
+        MakeUniqueObjectName(Outer, UProceduralMeshComponent::StaticClass(),
+                             *BaseName));
+    ChunkMesh->SetupAttachment(WallMeshComponent);
+    ChunkMesh->ComponentTags.Add(FName("DungeonComponent"));
+    ChunkMesh->ComponentTags.Add(
+        FName(*FString::Printf(TEXT("ChunkX:%d"), Section.ChunkCoord.X)));
+    ChunkMesh->ComponentTags.Add(
+        FName(*FString::Printf(TEXT("ChunkY:%d"), Section.ChunkCoord.Y)));
+    ChunkMesh->CreateMeshSection(
+        0, Section.Vertices, Section.Triangles, Section.Normals, Section.UVs,
+        TArray<FColor>(), TArray<FProcMeshTangent>(), true);
     if (CaveWallMaterial) {
-      WallMeshComponent->SetMaterial(0, CaveWallMaterial);
+      ChunkMesh->SetMaterial(0, CaveWallMaterial);
+    }
+    if (WallMeshComponent->IsRegistered()) {
+      ChunkMesh->RegisterComponent();
     }
 
+    WallChunkComponents.Add(Section.ChunkCoord, ChunkMesh);
+    TotalVertices += Section.Vertices.Num();
+  }
+
+  if (TotalVertices > 0) {
     UE_LOG(LogTemp, Log,
-           TEXT("DungeonMeshGenerator: Generated cave walls with %d vertices"),
-           Vertices.Num());
+           TEXT("DungeonMeshGenerator: Generated cave walls with %d vertices "
+                "in %d chunks"),
+           TotalVertices, WallChunkComponents.Num());
   }
 
   // 바닥 생성
@@ -86,130 +444,6 @@ uint8 UDungeonMeshGenerator::GetMarchingSquareConfig(
   return Config; // 0~15
 }
 
-void UDungeonMeshGenerator::GenerateMarchingSquareGeometry(
-    TArray<FVector> &Vertices, TArray<int32> &Triangles, TArray<FVector2D> &UVs,
-    TArray<FVector> &Normals, int32 X, int32 Y, uint8 Config) {
-  // 기준 위치
-  FVector BasePos(X * TileSize, Y * TileSize, 0.0f);
-
-  // 4개 코너 정점
-  FVector BL = BasePos;                                  // BottomLeft
-  FVector BR = BasePos + FVector(TileSize, 0, 0);        // BottomRight
-  FVector TR = BasePos + FVector(TileSize, TileSize, 0); // TopRight
-  FVector TL = BasePos + FVector(0, TileSize, 0);        // TopLeft
-
-  // 엣지 중간점 (보간 가능)
-  FVector Bot = GetInterpolatedVertex(X, Y, false, CurveSmoothing);
-  FVector Right = GetInterpolatedVertex(X + 1, Y, true, CurveSmoothing);
-  FVector Top = GetInterpolatedVertex(X, Y + 1, false, CurveSmoothing);
-  FVector Left = GetInterpolatedVertex(X, Y, true, CurveSmoothing);
-
-  int32 BaseIndex = Vertices.Num();
-
-  // Marching Squares 16가지 케이스
-  // 간소화: 대표적인 케이스만 구현
-  switch (Config) {
-  case 1: // ◣ (BL만)
-    Vertices.Append({BL, Bot, Left});
-    break;
-
-  case 2: // ◢ (BR만)
-    Vertices.Append({BR, Right, Bot});
-    break;
-
-  case 3: // ▬ (하단)
-    Vertices.Append({BL, BR, Right, Left});
-    break;
-
-  case 4: // ◥ (TR만)
-    Vertices.Append({TR, Top, Right});
-    break;
-
-  case 6: // ▐ (우측)
-    Vertices.Append({BR, TR, Top, Bot});
-    break;
-
-  case 8: // ◤ (TL만)
-    Vertices.Append({TL, Left, Top});
-    break;
-
-  case 9: // ▌ (좌측)
-    Vertices.Append({BL, Bot, Top, TL});
-    break;
-
-  case 12: // ▀ (상단)
-    Vertices.Append({TL, TR, Right, Left});
-    break;
-
-  default:
-    // 기타 케이스는 기본 쿼드
-    Vertices.Append({BL, BR, TR, TL});
-    break;
-  }
-
-  // 트라이앵글 추가 (quad = 2 triangles)
-  int32 VertCount = Vertices.Num() - BaseIndex;
-  if (VertCount == 3) {
-    Triangles.Append({BaseIndex, BaseIndex + 1, BaseIndex + 2});
-  } else if (VertCount == 4) {
-    Triangles.Append({BaseIndex, BaseIndex + 1, BaseIndex + 2});
-    Triangles.Append({BaseIndex, BaseIndex + 2, BaseIndex + 3});
-  }
-
-  // UV 및 노멀 추가
-  for (int32 i = 0; i < VertCount; i++) {
-    UVs.Add(FVector2D(0, 0)); // 간소화
-    Normals.Add(FVector::UpVector);
-  }
-
-  // 벽 높이 추가 (수직 extrude)
-  int32 TopBaseIndex = Vertices.Num();
-  for (int32 i = 0; i < VertCount; i++) {
-    FVector TopVert = Vertices[BaseIndex + i];
-    TopVert.Z += WallHeight;
-    Vertices.Add(TopVert);
-    UVs.Add(FVector2D(0, 1));
-    Normals.Add(FVector::UpVector);
-  }
-
-  // 측면 트라이앵글 추가
-  for (int32 i = 0; i < VertCount; i++) {
-    int32 Next = (i + 1) % VertCount;
-    Triangles.Append({BaseIndex + i, TopBaseIndex + i, TopBaseIndex + Next,
-                      BaseIndex + i, TopBaseIndex + Next, BaseIndex + Next});
-  }
-}
-
-void UDungeonMeshGenerator::ApplySmoothNormals(TArray<FVector> &Normals,
-                                               const TArray<FVector> &Vertices,
-                                               const TArray<int32> &Triangles) {
-  // 간소화된 노멀 스무딩
-  if (Normals.Num() != Vertices.Num()) {
-    return;
-  }
-
-  TArray<FVector> SmoothNormals;
-  SmoothNormals.SetNumZeroed(Vertices.Num());
-
-  // 트라이앵글 노멀 누적
-  for (int32 i = 0; i < Triangles.Num(); i += 3) {
-    FVector V0 = Vertices[Triangles[i]];
-    FVector V1 = Vertices[Triangles[i + 1]];
-    FVector V2 = Vertices[Triangles[i + 2]];
-
-    FVector Normal = FVector::CrossProduct(V1 - V0, V2 - V0).GetSafeNormal();
-
-    SmoothNormals[Triangles[i]] += Normal;
-    SmoothNormals[Triangles[i + 1]] += Normal;
-    SmoothNormals[Triangles[i + 2]] += Normal;
-  }
-
-  // 평균화
-  for (int32 i = 0; i < SmoothNormals.Num(); i++) {
-    Normals[i] = SmoothNormals[i].GetSafeNormal();
-  }
-}
-
 void UDungeonMeshGenerator::GenerateFloorMesh(
     const FDungeonGrid &Grid, UProceduralMeshComponent *FloorMeshComponent) {
   if (!FloorMeshComponent) {
@@ -311,13 +545,3 @@ bool UDungeonMeshGenerator::IsWall(int32 X, int32 Y,
 
   return Grid.GetTile(X, Y).Type == ETileType::Wall;
 }
-
-FVector UDungeonMeshGenerator::GetInterpolatedVertex(int32 X, int32 Y,
-                                                     bool bVertical,
-                                                     float T) const {
-  if (bVertical) {
-    return FVector(X * TileSize, (Y + T) * TileSize, 0);
-  } else {
-    return FVector((X + T) * TileSize, Y * TileSize, 0);
-  }
-}
@@ -3,6 +3,247 @@
 #include "GeometryScript/MeshAssetFunctions.h"
 #include "UDynamicMesh.h"
 #include "Components/DynamicMeshComponent.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMeshEditor.h"
+#include "MeshConstraintsUtil.h"
+#include "MeshSimplification.h"
+#include "Operations/MergeCoincidentMeshEdges.h"
+
+using UE::Geometry::FDynamicMesh3;
+
+namespace
+{
+	// 한 StaticMesh의 인스턴스 트랜스폼 묶음 (게임 스레드에서 스냅샷)
+	struct FChunkMergeBatch
+	{
+		int32 SourceIndex = INDEX_NONE;
+		TArray<FTransform> Transforms;
+	};
+
+	// 청크 하나의 병합 입력과 결과
+	struct FChunkMergeJob
+	{
+		FIntPoint ChunkCoord = FIntPoint::ZeroValue;
+		TArray<FChunkMergeBatch> Batches;
+		FDynamicMesh3 Result;
+	};
+
+	// 워커 스레드로 넘기는 전체 작업. UObject는 참조하지 않음
+	struct FChunkMergeWork
+	{
+		TArray<FDynamicMesh3> SourceMeshes;
+		TArray<FChunkMergeJob> Jobs;
+		FDungeonChunkMergeOptions Options;
+	};
+
+	using FChunkMergeWorkPtr = TSharedPtr<FChunkMergeWork, ESPMode::ThreadSafe>;
+
+	// 게임 스레드: 소스 메시 변환(캐시)과 인스턴스 트랜스폼 스냅샷
+	void SnapshotChunkJobs(
+		const TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>>& ChunkHISMs,
+		FChunkMergeWork& Work)
+	{
+		UDungeonMeshMerger::FMeshCache MeshCache;
+		TMap<UStaticMesh*, int32> SourceIndexByMesh;
+
+		Work.Jobs.Reserve(ChunkHISMs.Num());
+		for (const auto& Pair : ChunkHISMs)
+		{
+			FChunkMergeJob Job;
+			Job.ChunkCoord = Pair.Key;
+
+			for (UHierarchicalInstancedStaticMeshComponent* HISM : Pair.Value)
+			{
+				if (!IsValid(HISM) || !HISM->GetStaticMesh() || HISM->GetInstanceCount() == 0)
+				{
+					continue;
+				}
+
+				UStaticMesh* StaticMesh = HISM->GetStaticMesh();
+				int32 SourceIndex = INDEX_NONE;
+				if (const int32* Found = SourceIndexByMesh.Find(StaticMesh))
+				{
+					SourceIndex = *Found;
+				}
+				else if (UDynamicMesh* SourceMesh = UDungeonMeshMerger::GetSourceMeshWithCache(StaticMesh, MeshCache))
+				{
+					SourceIndex = Work.SourceMeshes.Num();
+					SourceMesh->ProcessMesh([&Work](const FDynamicMesh3& Mesh)
+					{
+						Work.SourceMeshes.Add(Mesh);
+					});
+					SourceIndexByMesh.Add(StaticMesh, SourceIndex);
+				}
+
+				if (SourceIndex == INDEX_NONE)
+				{
+					continue;
+				}
+
+				FChunkMergeBatch& Batch = Job.Batches.AddDefaulted_GetRef();
+				Batch.SourceIndex = SourceIndex;
+				Batch.Transforms.SetNumUninitialized(HISM->GetInstanceCount());
+				for (int32 i = 0; i < Batch.Transforms.Num(); i++)
+				{
+					HISM->GetInstanceTransform(i, Batch.Transforms[i], false);
+				}
+			}
+
+			if (Job.Batches.Num() > 0)
+			{
+				Work.Jobs.Add(MoveTemp(Job));
+			}
+		}
+
+		// 변환 결과는 SourceMeshes로 복사했으므로 캐시 해제
+		for (auto& Pair : MeshCache)
+		{
+			if (Pair.Value)
+			{
+				Pair.Value->RemoveFromRoot();
+			}
+		}
+	}
+
+	void AppendTransformed(FDynamicMesh3& Target, const FDynamicMesh3& Source, const FTransform& InstanceTransform)
+	{
+		const UE::Geometry::FTransformSRT3d Transform(InstanceTransform);
+
+		UE::Geometry::FMeshIndexMappings Mappings;
+		UE::Geometry::FDynamicMeshEditor Editor(&Target);
+		Editor.AppendMesh(&Source, Mappings,
+			[&Transform](int32, const FVector3d& Position) { return Transform.TransformPosition(Position); },
+			[&Transform](int32, const FVector3d& Normal) { return Transform.TransformNormal(Normal); });
+
+		// 음수 스케일(미러) 인스턴스는 와인딩 복구
+		if (Transform.GetDeterminant() < 0)
+		{
+			TArray<int32> AppendedTriangles;
+			AppendedTriangles.Reserve(Source.TriangleCount());
+			for (const TPair<int32, int32>& TrianglePair : Mappings.GetTriangleMap().GetForwardMap())
+			{
+				AppendedTriangles.Add(TrianglePair.Value);
+			}
+			Editor.ReverseTriangleOrientations(AppendedTriangles, true);
+		}
+	}
+
+	// 워커 스레드: 청크 하나의 메시 구축 (병합 -> 용접 -> 단순화)
+	void BuildChunkMesh(const FChunkMergeWork& Work, FChunkMergeJob& Job)
+	{
+		FDynamicMesh3& Merged = Job.Result;
+		Merged.EnableMatchingAttributes(Work.SourceMeshes[Job.Batches[0].SourceIndex]);
+
+		for (const FChunkMergeBatch& Batch : Job.Batches)
+		{
+			const FDynamicMesh3& Source = Work.SourceMeshes[Batch.SourceIndex];
+			for (const FTransform& InstanceTransform : Batch.Transforms)
+			{
+				AppendTransformed(Merged, Source, InstanceTransform);
+			}
+		}
+
+		if (Work.Options.bWeldEdges)
+		{
+			UE::Geometry::FMergeCoincidentMeshEdges Welder(&Merged);
+			Welder.Apply();
+		}
+
+		if (Work.Options.bSimplifyPlanar)
+		{
+			// 외곽 경계와 UV/노멀 이음새는 고정하고 평면 내부만 정리
+			UE::Geometry::FQEMSimplification Simplifier(&Merged);
+			Simplifier.MeshBoundaryConstraint = UE::Geometry::EEdgeRefineFlags::FullyConstrained;
+			UE::Geometry::FMeshConstraints Constraints;
+			UE::Geometry::FMeshConstraintsUtil::ConstrainAllSeams(Constraints, Merged, false, false);
+			Simplifier.SetExternalConstraints(MoveTemp(Constraints));
+			Simplifier.SimplifyToMinimalPlanar(Work.Options.PlanarAngleToleranceDeg);
+		}
+
+		Merged.CompactInPlace();
+	}
+
+	void BuildChunkMeshes(FChunkMergeWork& Work)
+	{
+		ParallelFor(Work.Jobs.Num(), [&Work](int32 JobIndex)
+		{
+			BuildChunkMesh(Work, Work.Jobs[JobIndex]);
+		});
+	}
+
+	// 게임 스레드: 구축된 메시로 컴포넌트 생성
+	UDynamicMeshComponent* CreateMergedComponent(
+		AActor* Owner, FName ComponentName, FDynamicMesh3&& Mesh,
+		const FDungeonChunkMergeOptions& Options, bool bAsyncCooking)
+	{
+		UDynamicMeshComponent* MergedComponent = NewObject<UDynamicMeshComponent>(Owner, ComponentName);
+		if (!MergedComponent)
+		{
+			return nullptr;
+		}
+
+		MergedComponent->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+		MergedComponent->SetMesh(MoveTemp(Mesh));
+
+		// 컬링 설정
+		MergedComponent->bNeverDistanceCull = true;
+		MergedComponent->SetBoundsScale(1.2f);
+
+		if (Options.bBuildCollision)
+		{
+			// 콜리전 설정 (Complex as Simple)
+			MergedComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+			MergedComponent->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
+			MergedComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
+
+			// 비동기 경로에서는 쿠킹도 게임 스레드 밖에서 수행
+			MergedComponent->bUseAsyncCooking = bAsyncCooking;
+			MergedComponent->bDeferCollisionUpdates = false;
+			MergedComponent->SetComplexAsSimpleCollisionEnabled(true, false);
+		}
+		else
+		{
+			MergedComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
+
+		MergedComponent->RegisterComponent();
+		MergedComponent->UpdateBounds();
+		MergedComponent->MarkRenderStateDirty();
+
+		return MergedComponent;
+	}
+
+	TMap<FIntPoint, UDynamicMeshComponent*> CreateMergedComponents(
+		AActor* Owner, FChunkMergeWork& Work, const FString& BaseName, bool bAsyncCooking)
+	{
+		TMap<FIntPoint, UDynamicMeshComponent*> Result;
+		Result.Reserve(Work.Jobs.Num());
+
+		for (FChunkMergeJob& Job : Work.Jobs)
+		{
+			if (Job.Result.TriangleCount() == 0)
+			{
+				continue;
+			}
+
+			// 청크별 고유 이름 생성 (같은 이름의 이전 머지 결과가 남아 있어도 충돌 없음)
+			const FString ChunkName = FString::Printf(TEXT("%s_C%d_%d"),
+				*BaseName, Job.ChunkCoord.X, Job.ChunkCoord.Y);
+			const FName ComponentName = MakeUniqueObjectName(
+				Owner, UDynamicMeshComponent::StaticClass(), *ChunkName);
+
+			if (UDynamicMeshComponent* MergedChunk = CreateMergedComponent(
+				Owner, ComponentName, MoveTemp(Job.Result), Work.Options, bAsyncCooking))
+			{
+				Result.Add(Job.ChunkCoord, MergedChunk);
+			}
+		}
+
+		return Result;
+	}
+}
 
 
 UDynamicMeshComponent* UDungeonMeshMerger::MergeHISMsToDynamicMesh(
@@ -160,60 +401,69 @@ void UDungeonMeshMerger::AppendStaticMeshInstances(
     }
 }
 
-void UDungeonMeshMerger::AppendStaticMeshInstancesWithCache(
+UDynamicMesh* UDungeonMeshMerger::GetSourceMeshWithCache(
 	UStaticMesh* StaticMesh,
-	const TArray<FTransform>& Transforms,
-	UDynamicMesh* OutMesh,
     FMeshCache& MeshCache)
 {
-	if (!StaticMesh || !OutMesh || Transforms.Num() == 0)
-	{
-		return;
-	}
+    if (!StaticMesh)
+    {
+        return nullptr;
+    }
 
     // Check Cache first
-    UDynamicMesh* SourceMesh = nullptr;
     if (UDynamicMesh** CachedMesh = MeshCache.Find(StaticMesh))
     {
-        SourceMesh = *CachedMesh;
+        return *CachedMesh;
     }
-    else
+
+    // Safety: Ensure StaticMesh has render data
+    if (!StaticMesh->GetRenderData())
     {
-        // Safety: Ensure StaticMesh has render data
-        if (!StaticMesh->GetRenderData())
-        {
-             UE_LOG(LogTemp, Warning, TEXT("DungeonMeshMerger: StaticMesh %s has no RenderData (CPU Access?)"), *StaticMesh->GetName());
-             return;
-        }
-
-    	// StaticMesh를 DynamicMesh로 변환 (Slow Operation)
-    	SourceMesh = NewObject<UDynamicMesh>();
-        SourceMesh->AddToRoot(); // Cache에서 관리하므로 Rooting 유지
-    	
-    	FGeometryScriptCopyMeshFromAssetOptions CopyOptions;
-    	FGeometryScriptMeshReadLOD ReadLOD;
-    	ReadLOD.LODType = EGeometryScriptLODType::MaxAvailable;
-    	
-    	EGeometryScriptOutcomePins Outcome;
-    	UGeometryScriptLibrary_StaticMeshFunctions::CopyMeshFromStaticMesh(
-    		StaticMesh,
-    		SourceMesh,
-    		CopyOptions,
-    		ReadLOD,
-    		Outcome);
-
-    	if (Outcome != EGeometryScriptOutcomePins::Success)
-    	{
-    		UE_LOG(LogTemp, Warning, TEXT("DungeonMeshMerger: Failed to copy mesh from StaticMesh %s"), 
-    			*StaticMesh->GetName());
-            SourceMesh->RemoveFromRoot();
-    		return;
-    	}
-        
-        // Add to Cache
-        MeshCache.Add(StaticMesh, SourceMesh);
+         UE_LOG(LogTemp, Warning, TEXT("DungeonMeshMerger: StaticMesh %s has no RenderData (CPU Access?)"), *StaticMesh->GetName());
+         return nullptr;
     }
+
+	// StaticMesh를 DynamicMesh로 변환 (Slow Operation)
+	UDynamicMesh* SourceMesh = NewObject<UDynamicMesh>();
+    SourceMesh->AddToRoot(); // Cache에서 관리하므로 Rooting 유지
+	
+	FGeometryScriptCopyMeshFromAssetOptions CopyOptions;
+	FGeometryScriptMeshReadLOD ReadLOD;
+	ReadLOD.LODType = EGeometryScriptLODType::MaxAvailable;
+	
+	EGeometryScriptOutcomePins Outcome;
+	UGeometryScriptLibrary_StaticMeshFunctions::CopyMeshFromStaticMesh(
+		StaticMesh,
+		SourceMesh,
+		CopyOptions,
+		ReadLOD,
+		Outcome);
+
+	if (Outcome != EGeometryScriptOutcomePins::Success)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DungeonMeshMerger: Failed to copy mesh from StaticMesh %s"), 
+			*StaticMesh->GetName());
+        SourceMesh->RemoveFromRoot();
+		return nullptr;
+	}
     
+    // Add to Cache
+    MeshCache.Add(StaticMesh, SourceMesh);
+    return SourceMesh;
+}
+
+void UDungeonMeshMerger::AppendStaticMeshInstancesWithCache(
+	UStaticMesh* StaticMesh,
+	const TArray<FTransform>& Transforms,
+	UDynamicMesh* OutMesh,
+    FMeshCache& MeshCache)
+{
+	if (!StaticMesh || !OutMesh || Transforms.Num() == 0)
+	{
+		return;
+	}
+
+    UDynamicMesh* SourceMesh = GetSourceMeshWithCache(StaticMesh, MeshCache);
     if (!SourceMesh) return;
 
 	// 각 트랜스폼으로 메시 추가 (Fast Operation)
@@ -233,7 +483,8 @@ void UDungeonMeshMerger::AppendStaticMeshInstancesWithCache(
 TMap<FIntPoint, UDynamicMeshComponent*> UDungeonMeshMerger::MergeHISMsPerChunk(
 	AActor* Owner,
 	const TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>>& ChunkHISMs,
-	const FString& BaseName)
+	const FString& BaseName,
+	const FDungeonChunkMergeOptions& Options)
 {
 	TMap<FIntPoint, UDynamicMeshComponent*> Result;
 
@@ -242,45 +493,71 @@ TMap<FIntPoint, UDynamicMeshComponent*> UDungeonMeshMerger::MergeHISMsPerChunk(
 		UE_LOG(LogTemp, Warning, TEXT("DungeonMeshMerger::MergeHISMsPerChunk - Owner is null"));
 		return Result;
 	}
-    
-    // 메시 캐시 생성 (함수 범위 내에서만 유효)
-    FMeshCache MeshCache;
 
-	for (const auto& Pair : ChunkHISMs)
-	{
-		const FIntPoint& ChunkCoord = Pair.Key;
-		const TArray<UHierarchicalInstancedStaticMeshComponent*>& HISMs = Pair.Value;
+	FChunkMergeWork Work;
+	Work.Options = Options;
+	SnapshotChunkJobs(ChunkHISMs, Work);
 
-		if (HISMs.Num() == 0)
-		{
-			continue;
-		}
+	// 청크 메시 구축은 병렬로, 컴포넌트 생성만 게임 스레드에서
+	BuildChunkMeshes(Work);
+	Result = CreateMergedComponents(Owner, Work, BaseName, false);
 
-		// 청크별 고유 이름 생성
-		FName ComponentName = FName(*FString::Printf(TEXT("%s_C%d_%d"), 
-			*BaseName, ChunkCoord.X, ChunkCoord.Y));
+	UE_LOG(LogTemp, Log, TEXT("DungeonMeshMerger: Merged %d chunks for %s"), 
+		Result.Num(), *BaseName);
 
-		// 기존 함수 재사용하여 해당 청크의 HISM들을 병합
-		UDynamicMeshComponent* MergedChunk = MergeHISMsToDynamicMeshWithCache(Owner, HISMs, ComponentName, MeshCache);
+	return Result;
+}
 
-		if (MergedChunk)
-		{
-			Result.Add(ChunkCoord, MergedChunk);
-		}
+void UDungeonMeshMerger::MergeHISMsPerChunkAsync(
+	AActor* Owner,
+	const TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>>& ChunkHISMs,
+	const FString& BaseName,
+	FOnChunksMerged OnComplete,
+	FIsMergeCurrent IsCurrent,
+	const FDungeonChunkMergeOptions& Options)
+{
+	if (!Owner)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DungeonMeshMerger::MergeHISMsPerChunkAsync - Owner is null"));
+		return;
 	}
 
-    // 캐시 정리 (Rooting 해제)
-    for (auto& Pair : MeshCache)
-    {
-        if (Pair.Value)
-        {
-            Pair.Value->RemoveFromRoot();
-        }
-    }
-    MeshCache.Empty();
+	FChunkMergeWorkPtr Work = MakeShared<FChunkMergeWork, ESPMode::ThreadSafe>();
+	Work->Options = Options;
+	SnapshotChunkJobs(ChunkHISMs, *Work);
 
-	UE_LOG(LogTemp, Log, TEXT("DungeonMeshMerger: Merged %d chunks for %s"), 
-		Result.Num(), *BaseName);
+	TWeakObjectPtr<AActor> WeakOwner(Owner);
+	Async(EAsyncExecution::ThreadPool, [Work, WeakOwner, BaseName, OnComplete, IsCurrent]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		BuildChunkMeshes(*Work);
+		const double BuildTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
 
-	return Result;
+		AsyncTask(ENamedThreads::GameThread, [Work, WeakOwner, BaseName, OnComplete, IsCurrent, BuildTimeMs]()
+		{
+			AActor* Owner = WeakOwner.Get();
+			if (!Owner)
+			{
+				return;
+			}
+
+			// 그 사이 정리/재생성되었으면 컴포넌트 생성/등록/쿠킹 전에 버림
+			if (IsCurrent && !IsCurrent())
+			{
+				UE_LOG(LogTemp, Log, TEXT("DungeonMeshMerger: Discarded stale merge for %s"), *BaseName);
+				return;
+			}
+
+			TMap<FIntPoint, UDynamicMeshComponent*> Result =
+				CreateMergedComponents(Owner, *Work, BaseName, true);
+
+			UE_LOG(LogTemp, Log, TEXT("DungeonMeshMerger: Merged %d chunks for %s (worker %.2f ms)"),
+				Result.Num(), *BaseName, BuildTimeMs);
+
+			if (OnComplete)
+			{
+				OnComplete(Result);
+			}
+		});
+	});
 }
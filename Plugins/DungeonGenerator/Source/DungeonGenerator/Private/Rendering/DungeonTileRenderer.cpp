@@ -1,7 +1,311 @@
 ﻿#include "Rendering/DungeonTileRenderer.h"
+#include "Rendering/DungeonChunkRegistry.h"
 #include "Rendering/DungeonChunkStreamer.h" 
 #include "Data/DungeonThemeAsset.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+namespace {
+    TAutoConsoleVariable<int32> CVarDungeonWallMaskStats(
+        TEXT("dungeon.TileRenderer.WallMaskStats"),
+        0,
+        TEXT("1 = collect and log the wall bitmask distribution on every tile generation."),
+        ECVF_Default);
+
+    // 벽이 아닌 타일의 코드 (8방향 마스크 0xFF와 구분하기 위해 16비트)
+    constexpr uint16 NonWallCode = 0xFFFF;
+    // 타일 코드 범위: 4방향 0~15, 8방향 0~255
+    constexpr int32 NumWallCodes = 256;
+    // 출력 슬롯 수 (4방향 마스크 16개 / 블롭 조각 15개)
+    constexpr int32 NumWallSlots = 16;
+
+    // 인스턴스 수집 밴드 최대 행 수 (청크를 이 단위로 나눠 병렬 처리)
+    constexpr int32 MaxBandRows = 32;
+
+    // 회전 정규형 블롭 조각 (47 케이스를 90도 회전으로 묶은 대표 마스크, 오름차순)
+    constexpr uint8 BlobCanonicalMasks[] = {0, 1, 5, 7, 17, 21, 23, 29, 31, 85, 87, 95, 119, 127, 255};
+    constexpr int32 NumBlobPieces = UE_ARRAY_COUNT(BlobCanonicalMasks);
+
+    // 8방향 마스크를 90도(Yaw +90, N -> E) 회전
+    uint8 RotateBlobMask(uint8 Mask, int32 Steps) {
+        const int32 Shift = (Steps & 3) * 2;
+        return (uint8)((Mask << Shift) | (Mask >> ((8 - Shift) & 7)));
+    }
+
+    // 인접한 두 방향이 모두 벽일 때만 대각선 유지 (256 -> 47 케이스)
+    uint8 ReduceBlobMask(uint8 Mask) {
+        uint8 Reduced = Mask & 0x55; // N, E, S, W
+        for (int32 Corner = 1; Corner < 8; Corner += 2) {
+            const uint8 Prev = (uint8)(1 << (Corner - 1));
+            const uint8 Next = (uint8)(1 << ((Corner + 1) & 7));
+            if ((Mask & (1 << Corner)) && (Mask & Prev) && (Mask & Next)) {
+                Reduced |= (uint8)(1 << Corner);
+            }
+        }
+        return Reduced;
+    }
+
+    struct FBlobAutotileEntry {
+        uint8 Piece = 0;    // BlobCanonicalMasks 인덱스
+        uint8 YawSteps = 0; // 90도 단위 회전
+    };
+
+    // 원시 8방향 마스크 256개 -> (조각, 회전) 룩업 테이블 (한 번만 계산)
+    struct FBlobAutotileLUT {
+        FBlobAutotileEntry Entries[256];
+
+        FBlobAutotileLUT() {
+            int32 PieceByMask[256];
+            FMemory::Memset(PieceByMask, 0xFF, sizeof(PieceByMask));
+            for (int32 Piece = 0; Piece < NumBlobPieces; Piece++) {
+                PieceByMask[BlobCanonicalMasks[Piece]] = Piece;
+            }
+
+            for (int32 Raw = 0; Raw < 256; Raw++) {
+                const uint8 Reduced = ReduceBlobMask((uint8)Raw);
+                // Reduced == Rotate(Canonical, Steps) 인 가장 작은 Steps
+                for (int32 Steps = 0; Steps < 4; Steps++) {
+                    const int32 Piece = PieceByMask[RotateBlobMask(Reduced, 4 - Steps)];
+                    if (Piece != INDEX_NONE) {
+                        Entries[Raw].Piece = (uint8)Piece;
+                        Entries[Raw].YawSteps = (uint8)Steps;
+                        break;
+                    }
+                }
+            }
+        }
+    };
+
+    const FBlobAutotileLUT& GetBlobAutotileLUT() {
+        static const FBlobAutotileLUT LUT;
+        return LUT;
+    }
+
+    // 타일 코드 -> 출력 슬롯 / 회전
+    struct FWallSlotTable {
+        int32 SlotByCode[NumWallCodes];
+        uint8 YawStepsByCode[NumWallCodes] = {};
+
+        FWallSlotTable() {
+            for (int32& Slot : SlotByCode) {
+                Slot = INDEX_NONE;
+            }
+        }
+    };
+
+    /**
+     * 그리드 전체의 벽 코드 계산 (행 단위 비트 연산)
+     * 행마다 벽 비트열을 만든 뒤 위/아래 행과 좌우 시프트로 이웃을 한 번에 구함
+     * - 4방향: GetWallBitmask와 동일 (N=1, E=2, S=4, W=8)
+     * - 8방향: N=1, NE=2, E=4, SE=8, S=16, SW=32, W=64, NW=128 (N=Y+, E=X-)
+     * 벽이 아닌 타일은 NonWallCode
+     */
+    void ComputeWallCodes(const FDungeonGrid& Grid, bool bEightDir, TArray<uint16>& OutCodes) {
+        const int32 Width = Grid.Width;
+        const int32 Height = Grid.Height;
+        const int32 WordsPerRow = (Width + 63) / 64;
+        if (Width <= 0 || Height <= 0) {
+            OutCodes.Reset();
+            return;
+        }
+
+        // X -> word X/64, bit X%64
+        TArray<uint64> WallRows;
+        WallRows.SetNumZeroed(WordsPerRow * Height);
+        ParallelFor(Height, [&](int32 Y) {
+            uint64* Row = &WallRows[Y * WordsPerRow];
+            const FDungeonTile* Tiles = &Grid.Tiles[Y * Width];
+            for (int32 X = 0; X < Width; X++) {
+                if (Tiles[X].Type == ETileType::Wall) {
+                    Row[X >> 6] |= uint64(1) << (X & 63);
+                }
+            }
+        });
+
+        // 비트 X에 X-1 / X+1 의 값을 가져옴 (이웃 word 경계 비트 포함)
+        auto FromLowerX = [WordsPerRow](const uint64* Row, int32 Word) -> uint64 {
+            return Row ? (Row[Word] << 1) | (Word > 0 ? Row[Word - 1] >> 63 : 0) : 0;
+        };
+        auto FromUpperX = [WordsPerRow](const uint64* Row, int32 Word) -> uint64 {
+            return Row ? (Row[Word] >> 1) | (Word + 1 < WordsPerRow ? Row[Word + 1] << 63 : 0) : 0;
+        };
+
+        OutCodes.SetNumUninitialized(Width * Height);
+        ParallelFor(Height, [&](int32 Y) {
+            const uint64* Row = &WallRows[Y * WordsPerRow];
+            const uint64* NorthRow = Y + 1 < Height ? &WallRows[(Y + 1) * WordsPerRow] : nullptr;
+            const uint64* SouthRow = Y > 0 ? &WallRows[(Y - 1) * WordsPerRow] : nullptr;
+            uint16* Codes = &OutCodes[Y * Width];
+
+            for (int32 Word = 0; Word < WordsPerRow; Word++) {
+                const uint64 Center = Row[Word];
+
+                // 방향별 이웃 비트 평면, 코드 비트 순서대로
+                uint64 Planes[8];
+                int32 NumPlanes = 0;
+                if (bEightDir) {
+                    Planes[0] = NorthRow ? NorthRow[Word] : 0;  // N  (Y+1)
+                    Planes[1] = FromLowerX(NorthRow, Word);     // NE (X-1, Y+1)
+                    Planes[2] = FromLowerX(Row, Word);          // E  (X-1)
+                    Planes[3] = FromLowerX(SouthRow, Word);     // SE (X-1, Y-1)
+                    Planes[4] = SouthRow ? SouthRow[Word] : 0;  // S  (Y-1)
+                    Planes[5] = FromUpperX(SouthRow, Word);     // SW (X+1, Y-1)
+                    Planes[6] = FromUpperX(Row, Word);          // W  (X+1)
+                    Planes[7] = FromUpperX(NorthRow, Word);     // NW (X+1, Y+1)
+                    NumPlanes = 8;
+                } else {
+                    Planes[0] = NorthRow ? NorthRow[Word] : 0;  // N (Y+1)
+                    Planes[1] = FromLowerX(Row, Word);          // E (X-1)
+                    Planes[2] = SouthRow ? SouthRow[Word] : 0;  // S (Y-1)
+                    Planes[3] = FromUpperX(Row, Word);          // W (X+1)
+                    NumPlanes = 4;
+                }
+
+                const int32 BaseX = Word * 64;
+                const int32 Count = FMath::Min(64, Width - BaseX);
+                for (int32 Bit = 0; Bit < Count; Bit++) {
+                    if (((Center >> Bit) & 1) == 0) {
+                        Codes[BaseX + Bit] = NonWallCode;
+                        continue;
+                    }
+                    uint16 Code = 0;
+                    for (int32 Plane = 0; Plane < NumPlanes; Plane++) {
+                        Code |= (uint16)(((Planes[Plane] >> Bit) & 1) << Plane);
+                    }
+                    Codes[BaseX + Bit] = Code;
+                }
+            }
+        });
+    }
+
+    // 청크 내 행 밴드 하나의 수집 결과
+    struct FWallInstanceBand {
+        int32 ChunkIndex = 0;
+        int32 MinX = 0;
+        int32 MaxX = 0;
+        int32 MinY = 0;
+        int32 MaxY = 0;
+        int32 CodeCounts[NumWallCodes] = {};
+        TArray<FTransform> TransformsBySlot[NumWallSlots];
+    };
+
+    // 청크(또는 그리드 전체)를 행 밴드로 분할. 밴드는 청크 순서대로 연속 배치
+    void BuildWallBands(int32 Width, int32 Height, int32 ChunkSize, int32& OutChunksX,
+        TArray<FWallInstanceBand>& OutBands) {
+        OutChunksX = 1;
+        if (Width <= 0 || Height <= 0) {
+            return;
+        }
+
+        const int32 ChunkExtent = ChunkSize > 0 ? ChunkSize : FMath::Max(Width, Height);
+        OutChunksX = FMath::DivideAndRoundUp(Width, ChunkExtent);
+        const int32 ChunksY = FMath::DivideAndRoundUp(Height, ChunkExtent);
+
+        for (int32 ChunkY = 0; ChunkY < ChunksY; ChunkY++) {
+            for (int32 ChunkX = 0; ChunkX < OutChunksX; ChunkX++) {
+                const int32 MinX = ChunkX * ChunkExtent;
+                const int32 MaxX = FMath::Min(MinX + ChunkExtent, Width);
+                const int32 MaxY = FMath::Min((ChunkY + 1) * ChunkExtent, Height);
+                for (int32 MinY = ChunkY * ChunkExtent; MinY < MaxY; MinY += MaxBandRows) {
+                    FWallInstanceBand& Band = OutBands.AddDefaulted_GetRef();
+                    Band.ChunkIndex = ChunkY * OutChunksX + ChunkX;
+                    Band.MinX = MinX;
+                    Band.MaxX = MaxX;
+                    Band.MinY = MinY;
+                    Band.MaxY = FMath::Min(MinY + MaxBandRows, MaxY);
+                }
+            }
+        }
+    }
+
+    // 밴드별 벽 트랜스폼 병렬 수집 (밴드 안에서는 행 우선 순서 유지)
+    void CollectWallTransforms(const TArray<uint16>& Codes, int32 Width, const FWallSlotTable& Slots,
+        float TileSize, const FVector& PivotOffset, TArray<FWallInstanceBand>& Bands) {
+        ParallelFor(Bands.Num(), [&](int32 BandIndex) {
+            FWallInstanceBand& Band = Bands[BandIndex];
+
+            // 1. 코드별 개수 (정확한 Reserve용)
+            for (int32 Y = Band.MinY; Y < Band.MaxY; Y++) {
+                const uint16* Row = &Codes[Y * Width];
+                for (int32 X = Band.MinX; X < Band.MaxX; X++) {
+                    if (Row[X] != NonWallCode) {
+                        Band.CodeCounts[Row[X]]++;
+                    }
+                }
+            }
+
+            int32 SlotCounts[NumWallSlots] = {};
+            for (int32 Code = 0; Code < NumWallCodes; Code++) {
+                if (Slots.SlotByCode[Code] != INDEX_NONE) {
+                    SlotCounts[Slots.SlotByCode[Code]] += Band.CodeCounts[Code];
+                }
+            }
+            for (int32 Slot = 0; Slot < NumWallSlots; Slot++) {
+                Band.TransformsBySlot[Slot].Reserve(SlotCounts[Slot]);
+            }
+
+            // 2. 트랜스폼 채우기 (회전은 90도 단위 Yaw)
+            for (int32 Y = Band.MinY; Y < Band.MaxY; Y++) {
+                const uint16* Row = &Codes[Y * Width];
+                for (int32 X = Band.MinX; X < Band.MaxX; X++) {
+                    const uint16 Code = Row[X];
+                    if (Code == NonWallCode || Slots.SlotByCode[Code] == INDEX_NONE) {
+                        continue;
+                    }
+                    const FVector Location = FVector(X * TileSize, Y * TileSize, 0.0f) + PivotOffset;
+                    const uint8 YawSteps = Slots.YawStepsByCode[Code];
+                    if (YawSteps == 0) {
+                        Band.TransformsBySlot[Slots.SlotByCode[Code]].Emplace(Location);
+                    } else {
+                        Band.TransformsBySlot[Slots.SlotByCode[Code]].Emplace(
+                            FRotator(0.0f, 90.0f * YawSteps, 0.0f), Location);
+                    }
+                }
+            }
+        });
+    }
+
+    // 밴드들의 코드별 개수 합
+    void SumCodeCounts(const TArray<FWallInstanceBand>& Bands, int32 (&OutCounts)[NumWallCodes]) {
+        FMemory::Memzero(OutCounts, sizeof(OutCounts));
+        for (const FWallInstanceBand& Band : Bands) {
+            for (int32 Code = 0; Code < NumWallCodes; Code++) {
+                OutCounts[Code] += Band.CodeCounts[Code];
+            }
+        }
+    }
+
+    // 디버그: 비트마스크 분포 로그 (CVar로 켰을 때만)
+    void LogWallMaskStats(const TCHAR* Label, const TArray<FWallInstanceBand>& Bands, bool bBlob) {
+        int32 CodeCounts[NumWallCodes];
+        SumCodeCounts(Bands, CodeCounts);
+
+        UE_LOG(LogTemp, Log, TEXT("=== DungeonTileRenderer (%s): Bitmask Distribution ==="), Label);
+        if (!bBlob) {
+            for (int32 Mask = 0; Mask < 16; Mask++) {
+                if (CodeCounts[Mask] > 0) {
+                    UE_LOG(LogTemp, Log, TEXT("  Mask %d (Binary: %d%d%d%d): %d tiles"),
+                        Mask, (Mask >> 3) & 1, (Mask >> 2) & 1, (Mask >> 1) & 1, Mask & 1,
+                        CodeCounts[Mask]);
+                }
+            }
+            return;
+        }
+
+        // 블롭: 회전 정규형 조각별로 집계
+        const FBlobAutotileLUT& LUT = GetBlobAutotileLUT();
+        int32 PieceCounts[NumBlobPieces] = {};
+        for (int32 Code = 0; Code < NumWallCodes; Code++) {
+            PieceCounts[LUT.Entries[Code].Piece] += CodeCounts[Code];
+        }
+        for (int32 Piece = 0; Piece < NumBlobPieces; Piece++) {
+            if (PieceCounts[Piece] > 0) {
+                UE_LOG(LogTemp, Log, TEXT("  Blob %d: %d tiles"), BlobCanonicalMasks[Piece], PieceCounts[Piece]);
+            }
+        }
+    }
+}
 
 UDungeonTileRenderer::UDungeonTileRenderer() {
     TileSize = 100.0f;
@@ -29,67 +333,42 @@ void UDungeonTileRenderer::GenerateBSPTiles(
     if (FloorISMC)
         FloorISMC->ClearInstances();
 
-    // 벽 타일 생성
-    TArray<FTransform> WallTransforms;
-    WallTransforms.Reserve(Grid.Width * Grid.Height / 4); // 대략적인 예약
-
-    // 디버그: 비트마스크 분포 카운트
-    TMap<uint8, int32> MaskCounts;
-
-    for (int32 Y = 0; Y < Grid.Height; Y++) {
-        for (int32 X = 0; X < Grid.Width; X++) {
-            const FDungeonTile& Tile = Grid.GetTile(X, Y);
-
-            if (Tile.Type == ETileType::Wall) {
-                // 비트마스크 계산
-                uint8 Mask = GetWallBitmask(X, Y, Grid);
-
-                // 디버그: 카운트 증가
-                MaskCounts.FindOrAdd(Mask)++;
-
-                // 메시 룩업
-                UStaticMesh** MeshPtr = WallMeshTable.Find(Mask);
-                if (MeshPtr && *MeshPtr) {
-                    // 메시가 ISMC에 설정되지 않았다면 설정
-                    if (WallISMC->GetStaticMesh() == nullptr) {
-                        WallISMC->SetStaticMesh(*MeshPtr);
-                    }
-
-                    // 트랜스폼 계산
-                    FTransform Transform;
-                    Transform.SetLocation(FVector(X * TileSize, Y * TileSize, 0.0f) + WallPivotOffset);
-                    Transform.SetRotation(FQuat::Identity);
-                    Transform.SetScale3D(FVector::OneVector);
-
-                    // 인스턴스 목록에 추가
-                    WallTransforms.Add(Transform);
-                }
-                else {
-                    // 기본 벽 메시 사용 (Mask 0)
-                    UStaticMesh** DefaultMesh = WallMeshTable.Find(0);
-                    if (DefaultMesh && *DefaultMesh) {
-                        if (WallISMC->GetStaticMesh() == nullptr) {
-                            WallISMC->SetStaticMesh(*DefaultMesh);
-                        }
+    // 벽 메시: 처음 찾은 마스크의 메시 하나로 모든 벽을 그림 (레거시 단일 ISMC, 4방향 전용)
+    FWallSlotTable Slots;
+    UStaticMesh* const* DefaultMesh = WallMeshTable.Find(0);
+    for (int32 Mask = 0; Mask < 16; Mask++) {
+        UStaticMesh* const* MeshPtr = WallMeshTable.Find(Mask);
+        const bool bHasMesh = (MeshPtr && *MeshPtr) || (DefaultMesh && *DefaultMesh);
+        Slots.SlotByCode[Mask] = bHasMesh ? 0 : INDEX_NONE;
+    }
 
-                        FTransform Transform;
-                        Transform.SetLocation(FVector(X * TileSize, Y * TileSize, 0.0f) + WallPivotOffset);
-                        WallTransforms.Add(Transform);
-                    }
-                }
-            }
+    // 벽 마스크 + 트랜스폼 수집 (행 밴드 단위 병렬)
+    TArray<uint16> Codes;
+    ComputeWallCodes(Grid, false, Codes);
+
+    int32 ChunksX = 0;
+    TArray<FWallInstanceBand> Bands;
+    BuildWallBands(Grid.Width, Grid.Height, 0, ChunksX, Bands);
+    CollectWallTransforms(Codes, Grid.Width, Slots, TileSize, WallPivotOffset, Bands);
+
+    // 메시가 ISMC에 설정되지 않았다면 행 우선으로 처음 나오는 벽의 메시로 설정
+    if (WallISMC->GetStaticMesh() == nullptr) {
+        for (const uint16 Code : Codes) {
+            if (Code == NonWallCode || Slots.SlotByCode[Code] == INDEX_NONE) continue;
+            UStaticMesh* const* MeshPtr = WallMeshTable.Find((uint8)Code);
+            WallISMC->SetStaticMesh(MeshPtr && *MeshPtr ? *MeshPtr : *DefaultMesh);
+            break;
         }
     }
 
-    // 디버그: 비트마스크 분포 로그 출력
-    UE_LOG(LogTemp, Warning, TEXT("=== DungeonTileRenderer: Bitmask Distribution ==="));
-    for (auto& Pair : MaskCounts) {
-        UE_LOG(LogTemp, Warning, TEXT("  Mask %d (Binary: %d%d%d%d): %d tiles"), 
-            Pair.Key, 
-            (Pair.Key >> 3) & 1, (Pair.Key >> 2) & 1, (Pair.Key >> 1) & 1, Pair.Key & 1,
-            Pair.Value);
+    TArray<FTransform> WallTransforms;
+    for (FWallInstanceBand& Band : Bands) {
+        WallTransforms.Append(MoveTemp(Band.TransformsBySlot[0]));
+    }
+
+    if (CVarDungeonWallMaskStats.GetValueOnGameThread() != 0) {
+        LogWallMaskStats(TEXT("Legacy"), Bands, false);
     }
-    UE_LOG(LogTemp, Warning, TEXT("==============================================="));
 
     // 일괄 추가 (NavMesh 업데이트 부하 감소)
     if (WallTransforms.Num() > 0) {
@@ -191,6 +470,17 @@ void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
     UHierarchicalInstancedStaticMeshComponent* CeilingHISM,
     UHierarchicalInstancedStaticMeshComponent* FloorHISM,
     TArray<UHierarchicalInstancedStaticMeshComponent*>& OutCreatedHISMs)
+{
+    GenerateBSPTilesMultiMesh(Grid, OwnerActor, CeilingHISM, FloorHISM, OutCreatedHISMs, nullptr);
+}
+
+void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
+    const FDungeonGrid& Grid,
+    AActor* OwnerActor,
+    UHierarchicalInstancedStaticMeshComponent* CeilingHISM,
+    UHierarchicalInstancedStaticMeshComponent* FloorHISM,
+    TArray<UHierarchicalInstancedStaticMeshComponent*>& OutCreatedHISMs,
+    FDungeonChunkRegistry* OutRegistry)
 {
     if (!OwnerActor) {
         UE_LOG(LogTemp, Error, TEXT("DungeonTileRenderer: OwnerActor is null"));
@@ -199,69 +489,76 @@ void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
 
     // 기존 HISM 정리
     OutCreatedHISMs.Empty();
+    if (OutRegistry) OutRegistry->Reset();
     if (CeilingHISM) CeilingHISM->ClearInstances();
     if (FloorHISM) FloorHISM->ClearInstances();
 
-    // 청크 좌표 계산용 헬퍼 람다
-    auto GetChunkCoord = [this](int32 X, int32 Y) -> FIntPoint {
-        return FIntPoint(X / ChunkSize, Y / ChunkSize);
-    };
-
-    // 청크별 + 마스크별 트랜스폼 맵
-    // Key: ChunkCoord, Value: (Mask -> Transforms)
-    TMap<FIntPoint, TMap<uint8, TArray<FTransform>>> ChunkMaskTransforms;
-
-    // 디버그: 비트마스크 분포 카운트
-    TMap<uint8, int32> MaskCounts;
-
-    // 1단계: 모든 벽 타일의 청크/마스크/트랜스폼 수집
-    for (int32 Y = 0; Y < Grid.Height; Y++) {
-        for (int32 X = 0; X < Grid.Width; X++) {
-            const FDungeonTile& Tile = Grid.GetTile(X, Y);
-
-            if (Tile.Type == ETileType::Wall) {
-                uint8 Mask = GetWallBitmask(X, Y, Grid);
-                MaskCounts.FindOrAdd(Mask)++;
+    // 타일 코드 -> 메시 슬롯/회전
+    // - 4방향: 슬롯 = 마스크 (메시 없는 마스크는 마스크 0으로 폴백)
+    // - 블롭: 슬롯 = 회전 정규형 조각, 256 LUT로 조각과 Yaw 결정 (없는 조각은 조각 0으로 폴백)
+    const bool bBlob = WallAutotileMode == EDungeonWallAutotileMode::Blob47;
+    FWallSlotTable Slots;
+    UStaticMesh* MeshBySlot[NumWallSlots] = {};
+    int32 SlotKeys[NumWallSlots] = {};
+    const int32 NumSlots = bBlob ? NumBlobPieces : 16;
+    for (int32 Slot = 0; Slot < NumSlots; Slot++) {
+        SlotKeys[Slot] = bBlob ? BlobCanonicalMasks[Slot] : Slot;
+        const TMap<uint8, UStaticMesh*>& Table = bBlob ? BlobWallMeshTable : WallMeshTable;
+        UStaticMesh* const* MeshPtr = Table.Find((uint8)SlotKeys[Slot]);
+        MeshBySlot[Slot] = MeshPtr ? *MeshPtr : nullptr;
+    }
 
-                FIntPoint ChunkCoord = bUseChunking ? GetChunkCoord(X, Y) : FIntPoint(0, 0);
+    auto ResolveSlot = [&MeshBySlot](int32 Slot) -> int32 {
+        return MeshBySlot[Slot] ? Slot : (MeshBySlot[0] ? 0 : INDEX_NONE);
+    };
+    if (bBlob) {
+        const FBlobAutotileLUT& LUT = GetBlobAutotileLUT();
+        for (int32 Code = 0; Code < NumWallCodes; Code++) {
+            const int32 Slot = ResolveSlot(LUT.Entries[Code].Piece);
+            Slots.SlotByCode[Code] = Slot;
+            // 폴백(조각 0)은 회전 없이 배치
+            Slots.YawStepsByCode[Code] = Slot == LUT.Entries[Code].Piece ? LUT.Entries[Code].YawSteps : 0;
+        }
+    } else {
+        for (int32 Mask = 0; Mask < 16; Mask++) {
+            Slots.SlotByCode[Mask] = ResolveSlot(Mask);
+        }
+    }
 
-                // 해당 마스크에 메시가 있는 경우만 처리
-                UStaticMesh** MeshPtr = WallMeshTable.Find(Mask);
-                uint8 ActualMask = Mask;
-                
-                if (!MeshPtr || !*MeshPtr) {
-                    // 폴백: 마스크 0 사용
-                    ActualMask = 0;
-                    UE_LOG(LogTemp, Warning, TEXT("DungeonTileRenderer: Mask %d has no mesh, falling back to 0 at (%d, %d)"), 
-                        Mask, X, Y);
-                }
-                
-                UStaticMesh** FinalMeshPtr = WallMeshTable.Find(ActualMask);
-                if (FinalMeshPtr && *FinalMeshPtr) {
-                    FTransform Transform;
-                    Transform.SetLocation(FVector(X * TileSize, Y * TileSize, 0.0f) + WallPivotOffset);
-                    Transform.SetRotation(FQuat::Identity);
-                    Transform.SetScale3D(FVector::OneVector);
-
-                    ChunkMaskTransforms.FindOrAdd(ChunkCoord).FindOrAdd(ActualMask).Add(Transform);
-                }
+    // 1단계: 벽 코드 계산 후 청크 행 밴드별로 트랜스폼 병렬 수집
+    TArray<uint16> Codes;
+    ComputeWallCodes(Grid, bBlob, Codes);
+
+    int32 ChunksX = 0;
+    TArray<FWallInstanceBand> Bands;
+    BuildWallBands(Grid.Width, Grid.Height, bUseChunking ? FMath::Max(1, ChunkSize) : 0, ChunksX, Bands);
+    CollectWallTransforms(Codes, Grid.Width, Slots, TileSize, WallPivotOffset, Bands);
+
+    // 폴백된 슬롯은 타일마다가 아니라 슬롯당 한 번만 경고
+    {
+        int32 CodeCounts[NumWallCodes];
+        SumCodeCounts(Bands, CodeCounts);
+
+        int32 FallbackCounts[NumWallSlots] = {};
+        for (int32 Code = 0; Code < NumWallCodes; Code++) {
+            const int32 WantedSlot = bBlob ? GetBlobAutotileLUT().Entries[Code].Piece : Code;
+            if (WantedSlot < NumSlots && Slots.SlotByCode[Code] != WantedSlot) {
+                FallbackCounts[WantedSlot] += CodeCounts[Code];
+            }
+        }
+        for (int32 Slot = 0; Slot < NumSlots; Slot++) {
+            if (FallbackCounts[Slot] > 0) {
+                UE_LOG(LogTemp, Warning, TEXT("DungeonTileRenderer: %s %d has no mesh, falling back to 0 for %d tiles"),
+                    bBlob ? TEXT("Blob piece") : TEXT("Mask"), SlotKeys[Slot], FallbackCounts[Slot]);
             }
         }
     }
 
-    // 디버그: 비트마스크 분포 로그 출력
-    UE_LOG(LogTemp, Warning, TEXT("=== DungeonTileRenderer (MultiMesh): Bitmask Distribution ==="));
-    for (auto& Pair : MaskCounts) {
-        UE_LOG(LogTemp, Warning, TEXT("  Mask %d (Binary: %d%d%d%d): %d tiles"), 
-            Pair.Key, 
-            (Pair.Key >> 3) & 1, (Pair.Key >> 2) & 1, (Pair.Key >> 1) & 1, Pair.Key & 1,
-            Pair.Value);
+    if (CVarDungeonWallMaskStats.GetValueOnGameThread() != 0) {
+        LogWallMaskStats(TEXT("MultiMesh"), Bands, bBlob);
+        UE_LOG(LogTemp, Log, TEXT("  Bands: %d (ChunkSize: %d, Chunking: %s)"),
+            Bands.Num(), ChunkSize, bUseChunking ? TEXT("ON") : TEXT("OFF"));
     }
-    
-    int32 NumChunks = ChunkMaskTransforms.Num();
-    UE_LOG(LogTemp, Warning, TEXT("  Total Chunks: %d (ChunkSize: %d, Chunking: %s)"), 
-        NumChunks, ChunkSize, bUseChunking ? TEXT("ON") : TEXT("OFF"));
-    UE_LOG(LogTemp, Warning, TEXT("============================================================"));
 
     // 디버그: 그리드 데이터를 파일로 출력 (옵션)
     if (bDebugOutputGrid) {
@@ -306,9 +603,9 @@ void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
                 const FDungeonTile& Tile = Grid.GetTile(X, Y);
                 
                 if (Tile.Type == ETileType::Wall) {
-                    uint8 Mask = GetWallBitmask(X, Y, Grid);
-                    // 16진수로 출력 (0-F)
-                    GridOutput += FString::Printf(TEXT("%X"), Mask);
+                    // 16진수로 출력 (4방향 0-F, 블롭은 정규형 조각 인덱스 0-E)
+                    const uint16 Code = Codes[Y * Grid.Width + X];
+                    GridOutput += FString::Printf(TEXT("%X"), bBlob ? GetBlobAutotileLUT().Entries[Code].Piece : Code);
                 } else if (Tile.Type == ETileType::Floor) {
                     GridOutput += TEXT(".");
                 } else if (Tile.Type == ETileType::Corridor) {
@@ -320,43 +617,73 @@ void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
             GridOutput += TEXT("\n");
         }
         
-        GridOutput += TEXT("\n=== Bitmask Legend ===\n");
-        GridOutput += TEXT("N=1, E=2, S=4, W=8\n");
-        GridOutput += TEXT("0=Isolated, 5=N+S(vertical), A=E+W(horizontal), F=All\n");
+        if (bBlob) {
+            // 블롭: 조각 인덱스 -> 정규형 마스크, 회전은 별도 격자로 출력
+            GridOutput += TEXT("\n=== Blob Piece Legend ===\n");
+            GridOutput += TEXT("N=1, NE=2, E=4, SE=8, S=16, SW=32, W=64, NW=128 (diagonal only with both sides)\n");
+            for (int32 Piece = 0; Piece < NumBlobPieces; Piece++) {
+                GridOutput += FString::Printf(TEXT("%X=0x%02X%s"), Piece, BlobCanonicalMasks[Piece],
+                    Piece + 1 < NumBlobPieces ? TEXT(", ") : TEXT("\n"));
+            }
+            GridOutput += TEXT("Yaw (grid below): piece mask rotated by Yaw x 90 (N -> E)\n\n");
+
+            for (int32 Y = 0; Y < Grid.Height; Y++) {
+                GridOutput += FString::Printf(TEXT("%2d| "), Y);
+                for (int32 X = 0; X < Grid.Width; X++) {
+                    const uint16 Code = Codes[Y * Grid.Width + X];
+                    if (Code == NonWallCode) {
+                        GridOutput += TEXT(" ");
+                    } else {
+                        GridOutput += FString::Printf(TEXT("%d"), GetBlobAutotileLUT().Entries[Code].YawSteps);
+                    }
+                }
+                GridOutput += TEXT("\n");
+            }
+        } else {
+            GridOutput += TEXT("\n=== Bitmask Legend ===\n");
+            GridOutput += TEXT("N=1, E=2, S=4, W=8\n");
+            GridOutput += TEXT("0=Isolated, 5=N+S(vertical), A=E+W(horizontal), F=All\n");
+        }
         
         FFileHelper::SaveStringToFile(GridOutput, *DebugFilePath);
         UE_LOG(LogTemp, Warning, TEXT("DungeonTileRenderer: Debug grid exported to: %s"), *DebugFilePath);
     }
 
-    // 2단계: 각 청크/마스크별로 ISMC 생성
+    // 2단계: 각 청크/마스크별로 HISM 생성 (AddInstances 한 번)
     int32 TotalISMCs = 0;
-    for (auto& ChunkPair : ChunkMaskTransforms) {
-        FIntPoint ChunkCoord = ChunkPair.Key;
-        TMap<uint8, TArray<FTransform>>& MaskTransforms = ChunkPair.Value;
-
-        for (auto& MaskPair : MaskTransforms) {
-            uint8 Mask = MaskPair.Key;
-            TArray<FTransform>& Transforms = MaskPair.Value;
+    int32 NumChunks = 0;
+    for (int32 BandStart = 0; BandStart < Bands.Num();) {
+        // 같은 청크의 밴드 범위 [BandStart, BandEnd)
+        int32 BandEnd = BandStart + 1;
+        while (BandEnd < Bands.Num() && Bands[BandEnd].ChunkIndex == Bands[BandStart].ChunkIndex) {
+            BandEnd++;
+        }
 
-            if (Transforms.Num() == 0) continue;
+        const int32 ChunkIndex = Bands[BandStart].ChunkIndex;
+        const FIntPoint ChunkCoord = bUseChunking ? FIntPoint(ChunkIndex % ChunksX, ChunkIndex / ChunksX) : FIntPoint(0, 0);
+        bool bChunkHasWalls = false;
 
-            // 해당 마스크의 메시 가져오기
-            UStaticMesh* Mesh = nullptr;
-            if (UStaticMesh** MeshPtr = WallMeshTable.Find(Mask)) {
-                Mesh = *MeshPtr;
-            } else if (UStaticMesh** DefaultMesh = WallMeshTable.Find(0)) {
-                Mesh = *DefaultMesh;
+        for (int32 Slot = 0; Slot < NumSlots; Slot++) {
+            // 밴드 결과를 행 순서대로 이어 붙임 (밴드가 하나면 그대로 이동)
+            TArray<FTransform> Transforms = MoveTemp(Bands[BandStart].TransformsBySlot[Slot]);
+            for (int32 BandIndex = BandStart + 1; BandIndex < BandEnd; BandIndex++) {
+                Transforms.Append(MoveTemp(Bands[BandIndex].TransformsBySlot[Slot]));
             }
 
+            if (Transforms.Num() == 0) continue;
+
+            UStaticMesh* Mesh = MeshBySlot[Slot];
             if (!Mesh) continue;
+            bChunkHasWalls = true;
+
+            // 4방향은 마스크(_M), 블롭은 정규형 조각 마스크(_B)
+            const int32 Mask = SlotKeys[Slot];
+            const TCHAR* KeyPrefix = bBlob ? TEXT("B") : TEXT("M");
 
             // 새 HISM 동적 생성 (청크 + 마스크 기반 이름)
-            FName ComponentName = FName(*FString::Printf(TEXT("Wall_C%d_%d_M%d"), 
-                ChunkCoord.X, ChunkCoord.Y, Mask));
-            
             // 에디터에서 저장되도록 Outer를 액터로 설정하고 플래그 지정
             // 중요: 이름 충돌을 원천 차단하기 위해 MakeUniqueObjectName 사용
-            FString BaseName = FString::Printf(TEXT("Wall_C%d_%d_M%d"), ChunkCoord.X, ChunkCoord.Y, Mask);
+            FString BaseName = FString::Printf(TEXT("Wall_C%d_%d_%s%d"), ChunkCoord.X, ChunkCoord.Y, KeyPrefix, Mask);
             FName UniqueName = MakeUniqueObjectName(OwnerActor, UHierarchicalInstancedStaticMeshComponent::StaticClass(), *BaseName);
             
             UHierarchicalInstancedStaticMeshComponent* NewHISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(
@@ -373,7 +700,7 @@ void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
             NewHISM->ComponentTags.Add(FName("DungeonComponent"));
             NewHISM->ComponentTags.Add(FName(*FString::Printf(TEXT("ChunkX:%d"), ChunkCoord.X)));
             NewHISM->ComponentTags.Add(FName(*FString::Printf(TEXT("ChunkY:%d"), ChunkCoord.Y)));
-            NewHISM->ComponentTags.Add(FName(*FString::Printf(TEXT("Mask:%d"), Mask)));
+            NewHISM->ComponentTags.Add(FName(*FString::Printf(TEXT("%s:%d"), bBlob ? TEXT("BlobMask") : TEXT("Mask"), Mask)));
             
             // 기존 이름 규칙도 유지 (Legacy support)
             NewHISM->SetStaticMesh(Mesh);
@@ -403,9 +730,15 @@ void UDungeonTileRenderer::GenerateBSPTilesMultiMesh(
 
             // Add to output array
             OutCreatedHISMs.Add(NewHISM);
+            if (OutRegistry) {
+                OutRegistry->AddWallHISM(ChunkCoord, NewHISM);
+            }
 
             TotalISMCs++;
         }
+
+        if (bChunkHasWalls) NumChunks++;
+        BandStart = BandEnd;
     }
 
     // 천장 생성 (HISM)
@@ -643,4 +976,16 @@ void UDungeonTileRenderer::ApplyTheme(const UDungeonThemeAsset* Theme) {
     if (Theme->FallbackWallMesh && !WallMeshTable.Contains(0)) {
          WallMeshTable.Add(0, Theme->FallbackWallMesh);
     }
+
+    // 블롭 조각 테이블 (int32 -> uint8), 폴백은 조각 0 (고립 기둥)
+    WallAutotileMode = Theme->WallAutotileMode;
+    BlobWallMeshTable.Empty();
+    for (const auto& Pair : Theme->BlobWallMeshTable) {
+        if (Pair.Key >= 0 && Pair.Key <= 255) {
+            BlobWallMeshTable.Add((uint8)Pair.Key, Pair.Value);
+        }
+    }
+    if (Theme->FallbackWallMesh && !BlobWallMeshTable.Contains(0)) {
+         BlobWallMeshTable.Add(0, Theme->FallbackWallMesh);
+    }
 }
@@ -61,4 +61,7 @@ private:
     static void EnforceVerticalAlignment(FMultiFloorDungeon& MultiFloor);
     static TArray<FStairPosition> PlaceStairs(FMultiFloorDungeon& MultiFloor, const FMultiFloorDungeonConfig& Config, FRandomStream& RandomStream);
     static void MarkStairTiles(FMultiFloorDungeon& MultiFloor);
+
+    // Kept across Generate calls so its node arena is reused
+    DungeonCore::CoreBSPGenerator CoreGen;
 };
@@ -25,18 +25,35 @@ public:
                         FRandomStream &RandomStream) override;
 
 private:
-  void SmoothMap(FDungeonGrid &Grid);
-  int32 GetSurroundingWallCount(const FDungeonGrid &Grid, int32 GridX,
-                                int32 GridY);
-
-  // Region Connection Logic
+  // Bitboard smoothing: rows packed into 64-bit words (1 = wall), neighbor
+  // counts via bit-sliced adders. Same 4-5 rule as the per-tile version.
+  void SmoothMap(FDungeonGrid &Grid, int32 Iterations);
+
+  // Double-buffered bitboards, (Height + 2) rows of all-wall padding rows.
+  // Kept across calls so repeated generation does not reallocate.
+  TArray<uint64> SmoothFront;
+  TArray<uint64> SmoothBack;
+  // Tiles whose neighbor count was ever != 4 (others keep their type)
+  TArray<uint64> SmoothTouched;
+
+  // Region Connection Logic: label floor regions, grow them through walls
+  // (multi-source BFS) to find the cheapest link per adjacent region pair,
+  // then carve the minimum spanning tree of those links.
   void ConnectRegions(FDungeonGrid &Grid, FRandomStream &RandomStream);
-  TArray<TArray<FDungeonTile>> GetRegions(const FDungeonGrid &Grid,
-                                          ETileType TileType);
-  TArray<FDungeonTile> GetRegionTiles(const FDungeonGrid &Grid, int32 StartX,
-                                      int32 StartY, ETileType TileType,
-                                      TSet<int32> &Visited);
-  void CreatePassage(FDungeonGrid &Grid, const FDungeonTile &TileA,
-                     const FDungeonTile &TileB);
+
+  // 4-connected component labeling. OutLabels[Y * Width + X] = region index
+  // or INDEX_NONE. Returns number of regions.
+  int32 LabelRegions(const FDungeonGrid &Grid, ETileType TileType,
+                     TArray<int32> &OutLabels);
+
+  // Label / owner / source / distance planes and BFS queue, reused across calls
+  TArray<int32> RegionLabels;
+  TArray<int32> RegionOwner;
+  TArray<int32> RegionSource;
+  TArray<int32> RegionDistance;
+  TArray<int32> RegionQueue;
+
+  void CreatePassage(FDungeonGrid &Grid, const FIntPoint &TileA,
+                     const FIntPoint &TileB);
   void Dig(FDungeonGrid &Grid, int32 X, int32 Y);
 };
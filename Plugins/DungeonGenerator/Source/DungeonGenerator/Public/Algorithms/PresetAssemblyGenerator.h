@@ -5,6 +5,16 @@
 #include "Data/DungeonPresetData.h"
 #include "PresetAssemblyGenerator.generated.h"
 
+/**
+ * 확장 대기 중인 소켓 정보 (World Space)
+ */
+struct FOpenSocketInfo {
+  FModuleSocket SocketData;
+  FIntPoint WorldPosition; // 이 소켓의 그리드 절대 좌표
+  int32 OwnerIndex = INDEX_NONE; // 소켓을 가진 배치 모듈 (PlacedModules 인덱스)
+  int32 ExcludedModuleIndex = INDEX_NONE; // 되돌리기 후 다시 고르지 않을 모듈
+};
+
 /**
  * 그리드 상에 배치된 모듈 정보
  */
@@ -13,14 +23,74 @@ struct FPlacedModule {
   FIntPoint Position; // 그리드 상의 원점 좌표
   FIntPoint Size;     // 모듈 크기 (회전 고려 시 변할 수 있음)
                       // int32 Rotation; // 0, 90, 180, 270 (V1에서는 생략)
+  int32 ModuleIndex = INDEX_NONE; // ModuleDatabase->Modules 인덱스
+  int32 ParentIndex = INDEX_NONE; // 연결된 부모 모듈 (Start는 없음)
+  int32 Depth = 0;                // Start로부터 연결 깊이
+  int32 ChildCount = 0;
+  FOpenSocketInfo ParentSocket;   // 이 모듈이 채운 부모 소켓 (되돌리기용)
 };
 
 /**
- * 확장 대기 중인 소켓 정보 (World Space)
+ * 확장 대기 소켓 집합 (순서 없음, 임의 원소 O(1) 제거)
  */
-struct FOpenSocketInfo {
-  FModuleSocket SocketData;
-  FIntPoint WorldPosition; // 이 소켓의 그리드 절대 좌표
+struct FOpenSocketFrontier {
+  TArray<FOpenSocketInfo> Sockets;
+
+  int32 Num() const { return Sockets.Num(); }
+  void Reset() { Sockets.Reset(); }
+  void Add(const FOpenSocketInfo &Info) { Sockets.Add(Info); }
+
+  /** 무작위 소켓 하나를 꺼냄 (마지막 원소와 교체 후 제거) */
+  FOpenSocketInfo PopRandom(FRandomStream &Stream) {
+    const int32 Index = Stream.RandRange(0, Sockets.Num() - 1);
+    FOpenSocketInfo Info = Sockets[Index];
+    Sockets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    return Info;
+  }
+};
+
+/**
+ * 조립 결과 평가 (높을수록 좋음)
+ */
+struct FPresetLayoutScore {
+  int32 ModuleCount = 0;
+  float BranchFactor = 0.0f;   // 자식이 있는 모듈의 평균 자식 수
+  int32 CriticalPathLength = 0; // Start에서 가장 먼 모듈까지의 깊이
+  float DeadEndRatio = 0.0f;   // 자식이 없는 모듈 비율 (Start 제외)
+  float Total = 0.0f;
+};
+
+/**
+ * 조립 시도 하나의 작업 상태 (후보끼리 공유하지 않음)
+ */
+struct FPresetAssemblyState {
+  FDungeonGrid Grid;
+  TArray<FPlacedModule> PlacedModules;
+  FOpenSocketFrontier OpenSockets;
+
+  // 채우지 못한 소켓 (되돌리기 후 공간이 생기면 다시 시도)
+  TArray<FOpenSocketInfo> DeadSockets;
+
+  // 후보 선택용 임시 힙 (키가 큰 후보부터 시도)
+  struct FCandidateKey {
+    float Key = 0.0f;     // Efraimidis-Spirakis 키 ln(u) / w
+    int32 MatchIndex = 0; // 소켓 인덱스 버킷 내 위치
+  };
+  TArray<FCandidateKey> CandidateScratch;
+
+  // 타일 점유 비트맵 (행마다 OccupancyWordsPerRow개의 uint64, 비트 = X칸)
+  TArray<uint64> Occupancy;
+  int32 OccupancyWordsPerRow = 0;
+
+  // 광역 판정용 거친 점유 비트맵 (BroadphaseCellSize 칸 블록 단위,
+  // 블록 안에 점유 칸이 하나라도 있으면 1. 되돌리기 시 지우지 않음 - 보수적)
+  static constexpr int32 BroadphaseShift = 3;
+  static constexpr int32 BroadphaseCellSize = 1 << BroadphaseShift;
+  TArray<uint64> CoarseOccupancy;
+  int32 CoarseWordsPerRow = 0;
+
+  /** 그리드/비트맵 초기화 */
+  void Reset(int32 Width, int32 Height);
 };
 
 /**
@@ -41,33 +111,59 @@ public:
 
   int32 MaxRoomCount = 20;
 
+  // 병렬로 돌릴 독립 조립 시도 수 (파생 시드). 1이면 단일 시도
+  int32 CandidateCount = 1;
+
+  // 채울 수 없는 소켓 때문에 확장이 멈췄을 때 마지막 모듈을 되돌리는 최대
+  // 횟수 (0이면 되돌리기 없음)
+  int32 MaxBacktrackSteps = 0;
+
+  // 후보 평가 가중치
+  float ScoreWeightModules = 1.0f;
+  float ScoreWeightBranching = 0.5f;
+  float ScoreWeightCriticalPath = 1.0f;
+  float ScoreWeightDeadEnds = 0.5f;
+
+  /** 마지막 Generate 결과 (선택된 후보) */
+  const TArray<FPlacedModule> &GetPlacedModules() const {
+    return PlacedModules;
+  }
+  const FPresetLayoutScore &GetLastScore() const { return LastScore; }
+
 private:
-  // 배치된 모듈 목록
+  // 선택된 후보의 배치 모듈 목록
   TArray<FPlacedModule> PlacedModules;
+  FPresetLayoutScore LastScore;
 
   // --- Helper Functions ---
 
-  /** 루트(Start) 모듈 배치 시도 */
-  bool PlaceStartModule(FDungeonGrid &Grid, FRandomStream &Stream,
-                        TArray<FOpenSocketInfo> &OutOpenSockets);
+  /** 시도 하나 실행 (State는 호출 측 소유, ModuleDatabase는 읽기만) */
+  bool RunAttempt(FPresetAssemblyState &State, FRandomStream &Stream) const;
 
-  /** 특정 소켓에 맞는 다음 모듈을 찾아 배치 시도 */
-  bool TryPlaceNextModule(FDungeonGrid &Grid, FRandomStream &Stream,
-                          const FOpenSocketInfo &TargetSocket,
-                          TArray<FOpenSocketInfo> &OutOpenSockets);
+  /** 후보 평가 */
+  FPresetLayoutScore ScoreLayout(const FPresetAssemblyState &State) const;
 
-  /** 모듈이 그리드 내에 있고 다른 모듈과 겹치지 않는지 확인 */
-  bool CanPlaceModule(const FDungeonGrid &Grid, const FModuleData &Module,
-                      FIntPoint Position);
-
-  /** 모듈을 그리드에 기록하고 새 소켓들을 반환 */
-  void StampModuleToGrid(FDungeonGrid &Grid, const FModuleData &Module,
+  /** 루트(Start) 모듈 배치 시도 */
+  bool PlaceStartModule(FPresetAssemblyState &State,
+                        FRandomStream &Stream) const;
+
+  /** 특정 소켓에 맞는 다음 모듈을 찾아 배치 시도 (소켓 인덱스 조회 +
+   * 가중치 순 시도) */
+  bool TryPlaceNextModule(FPresetAssemblyState &State, FRandomStream &Stream,
+                          const FOpenSocketInfo &TargetSocket) const;
+
+  /** 모듈이 그리드 내에 있고 다른 모듈과 겹치지 않는지 확인 (AABB 광역
+   * 판정 후 행 단위 비트마스크 AND) */
+  bool CanPlaceModule(const FPresetAssemblyState &State,
+                      const FModuleData &Module, FIntPoint Position) const;
+
+  /** 모듈을 그리드에 기록하고 새 소켓들을 추가 (ParentSocket이 있으면 그
+   * 소켓과 연결된 ConnectedSocketIndex는 대기열에서 제외) */
+  void StampModuleToGrid(FPresetAssemblyState &State, int32 ModuleIndex,
                          FIntPoint Position,
-                         TArray<FOpenSocketInfo> &OutNewSockets);
-
-  /** 소켓 방향의 역방향 구하기 (North <-> South) */
-  EModuleSocketDirection GetOppositeDirection(EModuleSocketDirection Dir);
+                         const FOpenSocketInfo *ParentSocket = nullptr,
+                         int32 ConnectedSocketIndex = INDEX_NONE) const;
 
-  /** 방향에 따른 좌표 오프셋 구하기 */
-  FIntPoint GetDirectionOffset(EModuleSocketDirection Dir);
+  /** 마지막 배치 모듈을 되돌리고 막혔던 소켓을 다시 대기열에 넣음 */
+  bool BacktrackLastModule(FPresetAssemblyState &State) const;
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Rendering/DungeonTileRenderer.h"
+#include "Rendering/DungeonChunkRegistry.h"
 #include "DungeonGrid.h"
 #include "Data/DungeonConfig.h"
 #include "DungeonRendererComponent.generated.h"
@@ -32,8 +33,22 @@ public:
 	UPROPERTY()
 	UDungeonTileRenderer* TileRenderer;
 
+	// --- Settings ---
+
+	/** Override the theme's wall autotile mode (e.g. force Blob47 for a level) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dungeon", meta=(InlineEditConditionToggle))
+	bool bOverrideWallAutotileMode = false;
+
+	/** Cardinal4: 16 masks, pieces may overlap at corners. Blob47: 8-neighbor LUT, one rotated piece per wall tile */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dungeon", meta=(EditCondition="bOverrideWallAutotileMode"))
+	EDungeonWallAutotileMode WallAutotileMode = EDungeonWallAutotileMode::Blob47;
+
 	// --- State ---
 
+	/** Serialized chunk membership (wall HISMs, merged meshes, bounds). Source of truth for the maps below */
+	UPROPERTY()
+	FDungeonChunkRegistry ChunkRegistry;
+
 	/** Map of Chunk Coordinate to Wall HISMs (for Streaming) */
 	TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>> ChunkHISMMap;
 
@@ -72,8 +87,9 @@ public:
 	void ClearDungeon();
 
 	/**
-	 * Manually rebuilds the internal Chunk Maps from existing components.
-	 * Useful after Load or PIE duplication.
+	 * Rebuilds the internal Chunk Maps from ChunkRegistry (no name/tag parsing).
+	 * Useful after Load or PIE duplication. Levels saved before the registry
+	 * existed are migrated once from component tags/names.
 	 */
 	void RebuildChunkMaps();
 
@@ -91,7 +107,9 @@ public:
     void HandlePostLoad(bool bIsPIE);
 
 private:
-	// Helper to parse component names into chunk coords (Legacy support)
-	// TODO: Use Component Tags in future
-	bool ParseChunkFromComponent(UActorComponent* Comp, FIntPoint& OutChunk, uint8& OutMask);
+	/** Game-thread completion of the async chunk merge started by GenerateDungeon */
+	void HandleChunksMerged(int32 RequestId, const TMap<FIntPoint, UDynamicMeshComponent*>& Merged, bool bRemoveOriginal, UDungeonChunkStreamer* ChunkStreamer);
+
+	/** Bumped by ClearDungeon so merges finishing after a clear/regenerate are discarded */
+	int32 MergeRequestId = 0;
 };
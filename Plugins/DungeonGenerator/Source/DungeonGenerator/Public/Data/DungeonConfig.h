@@ -59,6 +59,20 @@ public:
                         "Algorithm == EDungeonAlgorithmType::PresetAssembly"))
   TSoftObjectPtr<class UPresetModuleDatabase> PresetDatabase;
 
+  /** Parallel assembly attempts (derived seeds); the best-scoring one is kept */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation",
+            meta = (EditCondition =
+                        "Algorithm == EDungeonAlgorithmType::PresetAssembly",
+                    ClampMin = "1", ClampMax = "64"))
+  int32 PresetCandidateCount = 1;
+
+  /** Modules an attempt may undo when every open socket is blocked */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation",
+            meta = (EditCondition =
+                        "Algorithm == EDungeonAlgorithmType::PresetAssembly",
+                    ClampMin = "0"))
+  int32 PresetMaxBacktrackSteps = 0;
+
   // --- Theme ---
 
   /** The Visual Theme to use for this dungeon (Meshes, Materials) */
@@ -87,6 +87,49 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Module",
             meta = (ClampMin = "0.0"))
   float SelectionWeight = 1.0f;
+
+  // 모듈 영역 중 비어 있는 칸 (로컬 좌표, 비정형 모듈용)
+  // 비워두면 Size 전체를 차지하는 직사각형. 빈 칸에는 다른 모듈이 끼어들 수 있음
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Module")
+  TArray<FIntPoint> VoidTiles;
+
+  // 점유 비트마스크 (BuildFootprint()로 생성, 직렬화 안 함)
+  // 행 Y의 워드 W 비트 B = 로컬 (W * 64 + B, Y) 칸 점유
+  TArray<uint64> FootprintRows;
+  int32 FootprintWordsPerRow = 0;
+
+  /** Size와 VoidTiles로 점유 비트마스크 생성 */
+  void BuildFootprint();
+
+  bool HasFootprint() const {
+    return FootprintRows.Num() == FootprintWordsPerRow * Size.Y &&
+           FootprintWordsPerRow > 0;
+  }
+
+  /** 로컬 칸 점유 여부 */
+  bool IsFootprintTile(int32 X, int32 Y) const {
+    return (FootprintRows[Y * FootprintWordsPerRow + (X >> 6)] >> (X & 63)) &
+           1;
+  }
+};
+
+/**
+ * 소켓 호환 인덱스 항목 (미리 계산된 연결 후보)
+ * 대상 소켓의 월드 좌표 + OriginOffset = 새 모듈의 원점
+ */
+struct FModuleSocketMatch {
+  int32 ModuleIndex = INDEX_NONE; // UPresetModuleDatabase::Modules 인덱스
+  int32 SocketIndex = INDEX_NONE; // 해당 모듈의 Sockets 인덱스
+  FIntPoint OriginOffset = FIntPoint::ZeroValue;
+  float Weight = 1.0f; // 모듈의 SelectionWeight
+};
+
+/**
+ * 한 (방향, 태그) 조합으로 연결 가능한 후보 목록
+ */
+struct FModuleSocketBucket {
+  TArray<FModuleSocketMatch> Matches;
+  float TotalWeight = 0.0f;
 };
 
 /**
@@ -104,4 +147,47 @@ public:
   // 헬퍼 함수: 특정 타입의 모듈만 가져오기
   UFUNCTION(BlueprintCallable, Category = "Dungeon Modules")
   TArray<FModuleData> GetModulesByType(EDungeonPresetModuleType InType) const;
+
+  virtual void PostLoad() override;
+#if WITH_EDITOR
+  virtual void
+  PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif
+
+  /**
+   * 런타임 데이터 (재)구축: 모듈별 점유 비트마스크 + 소켓 호환 인덱스.
+   * 모듈 수정 후 또는 런타임에 Modules를 바꾼 뒤 호출. Start 모듈과 가중치
+   * 0인 모듈은 연결 후보에서 제외
+   */
+  void BuildRuntimeData();
+
+  /** 런타임 데이터가 없으면 구축 (생성 스레드를 띄우기 전에 호출) */
+  void EnsureRuntimeData() {
+    if (!bRuntimeDataBuilt) {
+      BuildRuntimeData();
+    }
+  }
+
+  /**
+   * 대상 소켓(방향, 태그)에 연결 가능한 후보 목록. 태그는 같거나 한쪽이
+   * None이면 호환. EnsureRuntimeData() 이후에만 유효
+   */
+  const FModuleSocketBucket &
+  FindSocketMatches(EModuleSocketDirection TargetDirection,
+                    FName TargetTag) const;
+
+  static EModuleSocketDirection
+  GetOppositeDirection(EModuleSocketDirection Dir);
+  static FIntPoint GetDirectionOffset(EModuleSocketDirection Dir);
+
+private:
+  // 후보 소켓 방향별 인덱스
+  struct FDirectionIndex {
+    FModuleSocketBucket AnyTag;        // 대상 태그가 None일 때 (전부)
+    FModuleSocketBucket UntaggedOnly;  // DB에 없는 태그일 때 (None 소켓만)
+    TMap<FName, FModuleSocketBucket> ByTag; // 같은 태그 + None 소켓
+  };
+
+  FDirectionIndex SocketIndex[4];
+  bool bRuntimeDataBuilt = false;
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Rendering/DungeonTileRenderer.h"
 #include "DungeonThemeAsset.generated.h"
 
 /**
@@ -37,6 +38,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meshes")
 	TMap<int32, UStaticMesh*> WallMeshTable;
 
+	/** Cardinal4 uses WallMeshTable; Blob47 picks one rotated piece per wall tile from BlobWallMeshTable */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meshes")
+	EDungeonWallAutotileMode WallAutotileMode = EDungeonWallAutotileMode::Cardinal4;
+
+	/** Map of canonical 8-neighbor blob mask (0, 1, 5, 7, 17, 21, 23, 29, 31, 85, 87, 95, 119, 127, 255) to Wall Mesh. See Doc/BitmaskReference.md */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meshes", meta=(EditCondition="WallAutotileMode == EDungeonWallAutotileMode::Blob47"))
+	TMap<int32, UStaticMesh*> BlobWallMeshTable;
+
 	/** Fallback wall mesh if table entry is missing or table is empty */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meshes")
 	UStaticMesh* FallbackWallMesh;
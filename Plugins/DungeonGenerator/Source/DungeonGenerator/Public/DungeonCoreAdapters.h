@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Async/ParallelFor.h"
 #include "CoreInterfaces.h"
 #include "Logging/LogMacros.h"
 #include "Math/RandomStream.h"
@@ -26,6 +27,20 @@ public:
   virtual int32_t RandRange(int32_t Min, int32_t Max) override {
     return RandomStream.RandRange(Min, Max);
   }
+
+  virtual std::unique_ptr<DungeonCore::IRandom>
+  CreateChild(int32_t Seed) const override {
+    return std::make_unique<FUnrealRandomAdapter>(Seed);
+  }
+};
+
+class FUnrealExecutorAdapter : public DungeonCore::IExecutor {
+public:
+  virtual void
+  ParallelFor(int32_t Count,
+              const std::function<void(int32_t)> &Body) override {
+    ::ParallelFor(Count, [&Body](int32 Index) { Body(Index); });
+  }
 };
 
 class FUnrealLoggerAdapter : public DungeonCore::ILogger {
@@ -6,6 +6,7 @@
 #include "Rendering/DungeonTileRenderer.h"
 #include "Rendering/DungeonNavigationBuilder.h"
 #include "Rendering/DungeonChunkStreamer.h"
+#include "Rendering/DungeonChunkRegistry.h"
 #include "DungeonFullTestActor.generated.h"
 
 /**
@@ -138,6 +139,10 @@ public:
     UPROPERTY(VisibleAnywhere, Transient, Category = "Generated")
     TArray<UHierarchicalInstancedStaticMeshComponent*> CreatedWallHISMs;
 
+    // 청크 소속 레지스트리 (직렬화) - 아래 맵들은 여기서 재구축됨
+    UPROPERTY()
+    FDungeonChunkRegistry ChunkRegistry;
+
     // 청크별 HISM 맵 (ChunkCoord -> HISMs) - 스트리밍/머징용
     // Note: TMap<FIntPoint, TArray<...>>는 UPROPERTY 지원 안됨
     TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>> ChunkHISMMap;
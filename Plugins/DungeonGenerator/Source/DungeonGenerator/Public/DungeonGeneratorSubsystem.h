@@ -3,7 +3,10 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "DungeonGrid.h"
+#include "ObjectPlacer.h"
 #include "Data/DungeonConfig.h"
+#include "Async/Future.h"
+#include <atomic>
 #include "DungeonGeneratorSubsystem.generated.h"
 
 // Forward declarations
@@ -18,6 +21,98 @@ class UInstancedStaticMeshComponent;
 class UProceduralMeshComponent;
 class APointLight;
 
+/**
+ * Stages reported by asynchronous dungeon generation
+ */
+UENUM(BlueprintType)
+enum class EDungeonGenerationStage : uint8 {
+  Grid UMETA(DisplayName = "Grid"),
+  MonsterZones UMETA(DisplayName = "Monster Zones"),
+  Props UMETA(DisplayName = "Props"),
+  MonsterClusters UMETA(DisplayName = "Monster Clusters"),
+  Completed UMETA(DisplayName = "Completed")
+};
+
+/**
+ * Settings for asynchronous dungeon generation
+ * (grid algorithm + object placement + analysis, all off the game thread)
+ */
+USTRUCT(BlueprintType)
+struct DUNGEONGENERATOR_API FDungeonAsyncGenerationSettings {
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
+  int32 Width = 50;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
+  int32 Height = 50;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
+  int32 Seed = 12345;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
+  EDungeonAlgorithmType AlgorithmType = EDungeonAlgorithmType::BSP;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Analysis")
+  bool bCalculateMonsterZones = true;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Analysis",
+            meta = (EditCondition = "bCalculateMonsterZones"))
+  float MonsterZoneRadius = 10.0f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Analysis",
+            meta = (EditCondition = "bCalculateMonsterZones"))
+  int32 MinOpenSpace = 50;
+
+  /** Props to place (empty = skip prop placement) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+  TArray<FPropConfig> PropConfigs;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+  bool bEnforcePropDiversity = true;
+
+  /** Monster clusters to find (0 = skip) */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+  int32 MaxMonsterClusters = 0;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement",
+            meta = (EditCondition = "MaxMonsterClusters > 0"))
+  FMonsterClusterConfig MonsterClusterConfig;
+};
+
+/**
+ * Result of asynchronous dungeon generation
+ */
+USTRUCT(BlueprintType)
+struct DUNGEONGENERATOR_API FDungeonGenerationResult {
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "Dungeon")
+  FDungeonGrid Grid;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Dungeon")
+  TArray<FPropData> Props;
+
+  UPROPERTY(BlueprintReadOnly, Category = "Dungeon")
+  TArray<FMonsterCluster> MonsterClusters;
+
+  /** Worker-side time spent (ms) */
+  UPROPERTY(BlueprintReadOnly, Category = "Dungeon")
+  float GenerationTimeMs = 0.0f;
+};
+
+DECLARE_DELEGATE_TwoParams(FOnDungeonAsyncProgress, float /*Progress*/,
+                           EDungeonGenerationStage /*Stage*/);
+DECLARE_DELEGATE_TwoParams(FOnDungeonAsyncFinished, bool /*bCancelled*/,
+                           const FDungeonGenerationResult & /*Result*/);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDungeonGenerationProgress,
+                                             float, Progress,
+                                             EDungeonGenerationStage, Stage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+    FOnDungeonGenerationFinished, bool, bCancelled,
+    const FDungeonGenerationResult &, Result);
+
 /**
  * Dungeon Generator Subsystem
  * Handles dungeon generation using different algorithms
@@ -39,12 +134,56 @@ public:
   FDungeonGrid GenerateDungeon(int32 Width, int32 Height, int32 Seed,
                                EDungeonAlgorithmType AlgorithmType);
 
+  /**
+   * Generate a dungeon on a worker thread (grid, analysis, placement).
+   * Callbacks run on the game thread. Starting a new request cancels the
+   * previous one. Only rendering (RenderDungeon) remains on the game thread.
+   * @return Request id (0 on validation failure)
+   */
+  int32 GenerateDungeonAsync(const FDungeonAsyncGenerationSettings &Settings,
+                             FOnDungeonAsyncProgress OnProgress =
+                                 FOnDungeonAsyncProgress(),
+                             FOnDungeonAsyncFinished OnFinished =
+                                 FOnDungeonAsyncFinished());
+
+  /** Blueprint entry point (results through OnGenerationProgress/Finished) */
+  UFUNCTION(BlueprintCallable, Category = "Dungeon|Async",
+            meta = (DisplayName = "Start Dungeon Generation Async"))
+  int32 StartGenerateDungeonAsync(
+      const FDungeonAsyncGenerationSettings &Settings) {
+    return GenerateDungeonAsync(Settings);
+  }
+
+  /** Cancel the running async generation (finished callback reports it) */
+  UFUNCTION(BlueprintCallable, Category = "Dungeon|Async")
+  void CancelAsyncGeneration();
+
+  UFUNCTION(BlueprintPure, Category = "Dungeon|Async")
+  bool IsGeneratingAsync() const { return ActiveJob.IsValid(); }
+
+  UFUNCTION(BlueprintPure, Category = "Dungeon|Async")
+  float GetAsyncGenerationProgress() const;
+
+  /** Request id of the running async generation (0 if none) */
+  int32 GetActiveAsyncRequestId() const {
+    return ActiveJob ? ActiveJob->RequestId : 0;
+  }
+
+  UPROPERTY(BlueprintAssignable, Category = "Dungeon|Async")
+  FOnDungeonGenerationProgress OnGenerationProgress;
+
+  UPROPERTY(BlueprintAssignable, Category = "Dungeon|Async")
+  FOnDungeonGenerationFinished OnGenerationFinished;
+
   /**
    * Get the currently generated grid
    */
   UFUNCTION(BlueprintPure, Category = "Dungeon")
   FDungeonGrid GetCurrentGrid() const { return CurrentGrid; }
 
+  /** C++ access without copying the grid */
+  const FDungeonGrid &GetCurrentGridRef() const { return CurrentGrid; }
+
   /**
    * Render the dungeon with walls, ceiling, floor, and lighting
    */
@@ -102,6 +241,40 @@ public:
   TSubclassOf<APointLight> CorridorLightClass;
 
 private:
+  // Shared between the game thread and the worker of one async request
+  struct FAsyncJob {
+    int32 RequestId = 0;
+    std::atomic<bool> bCancelled{false};
+    std::atomic<float> Progress{0.0f};
+    FDungeonAsyncGenerationSettings Settings;
+    FDungeonGenerationResult Result;
+    FOnDungeonAsyncProgress OnProgress;
+    FOnDungeonAsyncFinished OnFinished;
+    TFuture<void> Future;
+  };
+
+  // Cached algorithm instance per type (configured on the game thread)
+  UDungeonAlgorithm *GetAlgorithm(EDungeonAlgorithmType AlgorithmType);
+
+  using FAsyncJobPtr = TSharedPtr<FAsyncJob, ESPMode::ThreadSafe>;
+
+  // Worker-side pipeline. Touches only Job and Algo (no other UObjects)
+  static void RunAsyncJob(const FAsyncJobPtr &Job, UDungeonAlgorithm *Algo,
+                          TWeakObjectPtr<UDungeonGeneratorSubsystem> Owner);
+
+  void HandleAsyncProgress(const FAsyncJobPtr &Job, float Progress,
+                           EDungeonGenerationStage Stage);
+  void HandleAsyncFinished(const FAsyncJobPtr &Job);
+
+  // Cancel and block until the worker has left the shared algorithm object
+  void WaitForAsyncJob();
+
+  FAsyncJobPtr ActiveJob;
+  int32 NextRequestId = 1;
+
+  UPROPERTY()
+  TMap<EDungeonAlgorithmType, UDungeonAlgorithm *> AlgorithmCache;
+
   UPROPERTY()
   FDungeonGrid CurrentGrid;
 
@@ -91,17 +91,33 @@ struct FDungeonGrid {
     }
   }
 
-  // Convert to Core Grid
+  // View this grid's tile memory as a Core Grid (no copy).
+  // Core algorithms read and write Tiles directly through the view.
+  // Valid only while Tiles is not reallocated (do not Init/SetNum meanwhile).
+  DungeonCore::CoreDungeonGrid ViewAsCore() {
+    static_assert(sizeof(ETileType) == sizeof(DungeonCore::ETileType),
+                  "Tile type enums must share the same layout");
+    if (Tiles.Num() != Width * Height || Tiles.Num() == 0) {
+      return DungeonCore::CoreDungeonGrid();
+    }
+    FDungeonTile &First = Tiles[0];
+    return DungeonCore::CoreDungeonGrid::MakeView(
+        Width, Height, sizeof(FDungeonTile),
+        reinterpret_cast<DungeonCore::ETileType *>(&First.Type),
+        &First.RoomID, &First.MonsterSuitability, &First.StairTargetFloor);
+  }
+
+  // Convert to Core Grid (deep copy, for callers that need owned storage)
   DungeonCore::CoreDungeonGrid ToCore() const {
     DungeonCore::CoreDungeonGrid CoreGrid(
         Width, Height, DungeonConverter::ToCore(ETileType::Wall));
     for (int32 i = 0; i < Tiles.Num(); ++i) {
-      CoreGrid.Tiles[i].X = Tiles[i].X;
-      CoreGrid.Tiles[i].Y = Tiles[i].Y;
-      CoreGrid.Tiles[i].Type = DungeonConverter::ToCore(Tiles[i].Type);
-      CoreGrid.Tiles[i].RoomID = Tiles[i].RoomID;
-      CoreGrid.Tiles[i].MonsterSuitability = Tiles[i].MonsterSuitability;
-      CoreGrid.Tiles[i].StairTargetFloor = Tiles[i].StairTargetFloor;
+      // Optional planes are only allocated for non-default values
+      auto CoreTile = CoreGrid.GetTile(i % Width, i / Width);
+      CoreTile.Type = DungeonConverter::ToCore(Tiles[i].Type);
+      CoreTile.RoomID = Tiles[i].RoomID;
+      CoreTile.MonsterSuitability = Tiles[i].MonsterSuitability;
+      CoreTile.StairTargetFloor = Tiles[i].StairTargetFloor;
     }
     return CoreGrid;
   }
@@ -112,8 +128,10 @@ struct FDungeonGrid {
     Height = CoreGrid.Height;
     Tiles.SetNum(Width * Height);
 
-    for (int32 i = 0; i < CoreGrid.Tiles.size(); ++i) {
-      Tiles[i] = FDungeonTile(CoreGrid.Tiles[i]);
+    for (int32 Y = 0; Y < Height; ++Y) {
+      for (int32 X = 0; X < Width; ++X) {
+        Tiles[Y * Width + X] = FDungeonTile(CoreGrid.GetTile(X, Y));
+      }
     }
   }
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DungeonGeneratorSubsystem.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "AsyncAction_GenerateDungeon.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FDungeonAsyncProgressPin, float,
+                                             Progress,
+                                             EDungeonGenerationStage, Stage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
+    FDungeonAsyncResultPin, const FDungeonGenerationResult &, Result);
+
+/**
+ * Latent Blueprint node for background dungeon generation.
+ * Grid, analysis and placement run on a worker thread; all pins fire on the
+ * game thread. Render the result with RenderDungeon from OnCompleted.
+ */
+UCLASS()
+class DUNGEONGENERATOR_API UAsyncAction_GenerateDungeon
+    : public UBlueprintAsyncActionBase {
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintCallable, Category = "Dungeon|Async",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject"))
+  static UAsyncAction_GenerateDungeon *
+  GenerateDungeonAsync(UObject *WorldContextObject,
+                       const FDungeonAsyncGenerationSettings &Settings);
+
+  /** Cancel this request (OnCancelled fires once the worker stops) */
+  UFUNCTION(BlueprintCallable, Category = "Dungeon|Async")
+  void Cancel();
+
+  virtual void Activate() override;
+
+  UPROPERTY(BlueprintAssignable)
+  FDungeonAsyncProgressPin OnProgress;
+
+  UPROPERTY(BlueprintAssignable)
+  FDungeonAsyncResultPin OnCompleted;
+
+  UPROPERTY(BlueprintAssignable)
+  FDungeonAsyncResultPin OnCancelled;
+
+private:
+  void HandleProgress(float Progress, EDungeonGenerationStage Stage);
+  void HandleFinished(bool bCancelled, const FDungeonGenerationResult &Result);
+
+  UPROPERTY(Transient)
+  TObjectPtr<UDungeonGeneratorSubsystem> Subsystem;
+
+  FDungeonAsyncGenerationSettings Settings;
+  int32 RequestId = 0;
+};
@@ -91,44 +91,6 @@ struct FMonsterCluster {
   int32 ActualMonsterCount = 0;
 };
 
-// Helper structure for spatial hashing optimization
-struct FSpatialGrid {
-  TMap<int32, TArray<FIntPoint>> Cells;
-  int32 CellSize;
-  int32 GridWidth;
-
-  FSpatialGrid(int32 InCellSize, int32 InGridWidth)
-      : CellSize(InCellSize), GridWidth(InGridWidth) {}
-
-  int32 GetCellKey(int32 X, int32 Y) const {
-    return (X / CellSize) * 10000 + (Y / CellSize);
-  }
-
-  void AddTile(int32 X, int32 Y) {
-    Cells.FindOrAdd(GetCellKey(X, Y)).Add(FIntPoint(X, Y));
-  }
-
-  void QueryRadius(int32 X, int32 Y, float Radius,
-                   TArray<FIntPoint> &OutTiles) const {
-    const int32 CellRadius = FMath::CeilToInt(Radius / CellSize);
-    const int32 CenterCellX = X / CellSize;
-    const int32 CenterCellY = Y / CellSize;
-
-    OutTiles.Reset();
-    for (int32 dy = -CellRadius; dy <= CellRadius; dy++) {
-      for (int32 dx = -CellRadius; dx <= CellRadius; dx++) {
-        const int32 CheckX = (CenterCellX + dx) * CellSize;
-        const int32 CheckY = (CenterCellY + dy) * CellSize;
-        const int32 Key = GetCellKey(CheckX, CheckY);
-
-        if (const TArray<FIntPoint> *Cell = Cells.Find(Key)) {
-          OutTiles.Append(*Cell);
-        }
-      }
-    }
-  }
-};
-
 UCLASS()
 class DUNGEONGENERATOR_API UObjectPlacer : public UObject {
   GENERATED_BODY()
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DungeonChunkRegistry.generated.h"
+
+class AActor;
+class UHierarchicalInstancedStaticMeshComponent;
+class UDynamicMeshComponent;
+
+/**
+ * 청크 하나를 구성하는 컴포넌트 기록
+ */
+USTRUCT()
+struct DUNGEONGENERATOR_API FDungeonChunkRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FIntPoint ChunkCoord = FIntPoint::ZeroValue;
+
+	// 청크의 벽 HISM들 (마스크별)
+	UPROPERTY()
+	TArray<TObjectPtr<UHierarchicalInstancedStaticMeshComponent>> WallHISMs;
+
+	// 청크 머지 메시 (머징 활성화 시)
+	UPROPERTY()
+	TObjectPtr<UDynamicMeshComponent> MergedMesh = nullptr;
+
+	// 청크 컴포넌트들의 월드 바운드 합
+	UPROPERTY()
+	FBox Bounds = FBox(ForceInit);
+};
+
+/**
+ * 청크 -> 컴포넌트 레지스트리 (직렬화됨)
+ * 생성 시 채워 두면 로드/PIE 복제 후 컴포넌트 이름/태그를 파싱하지 않고
+ * 바로 청크 맵을 복구할 수 있음. 좌표 조회는 O(1) (인덱스는 필요할 때 재구축)
+ */
+USTRUCT()
+struct DUNGEONGENERATOR_API FDungeonChunkRegistry
+{
+	GENERATED_BODY()
+
+	// 직접 수정했다면 MarkIndexDirty() 호출
+	UPROPERTY()
+	TArray<FDungeonChunkRecord> Records;
+
+	int32 Num() const { return Records.Num(); }
+
+	// 다음 조회에서 좌표 인덱스 재구축
+	void MarkIndexDirty() { bIndexDirty = true; }
+
+	// 역직렬화/트랜잭션 복원으로 Records가 바뀐 경우 인덱스 무효화
+	void PostSerialize(const FArchive& Ar) { MarkIndexDirty(); }
+
+	void Reset();
+
+	// 청크 기록 조회 (없으면 nullptr)
+	const FDungeonChunkRecord* Find(FIntPoint ChunkCoord) const;
+
+	// 청크 기록 조회 또는 추가
+	FDungeonChunkRecord& FindOrAdd(FIntPoint ChunkCoord);
+
+	// 벽 HISM 등록 (바운드 확장)
+	void AddWallHISM(FIntPoint ChunkCoord, UHierarchicalInstancedStaticMeshComponent* HISM);
+
+	// 머지 메시 등록 (바운드 확장)
+	void SetMergedMesh(FIntPoint ChunkCoord, UDynamicMeshComponent* MergedMesh);
+
+	// 모든 청크의 벽 HISM 참조 제거 (머지 후 원본 삭제 시)
+	void ClearWallHISMs();
+
+	// 파괴된 컴포넌트 참조와 빈 청크 제거 후 인덱스 재구축 (로드 후 호출)
+	void RemoveInvalid();
+
+	// 스트리머/머저가 쓰는 맵 형태로 변환
+	void BuildWallHISMMap(TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>>& OutWallHISMs) const;
+	void BuildMergedMeshMap(TMap<FIntPoint, UDynamicMeshComponent*>& OutMergedMeshes) const;
+
+	/**
+	 * 레지스트리 없이 저장된 이전 레벨용: Owner의 컴포넌트 태그/이름
+	 * (Wall_C{X}_{Y}_M{Mask}, {Prefix}_C{X}_{Y})에서 한 번만 채움
+	 * @return 등록한 청크 수
+	 */
+	int32 MigrateFromComponents(AActor* Owner);
+
+private:
+	// 좌표 -> Records 인덱스 (직렬화 안 함, bIndexDirty면 재구축)
+	mutable TMap<FIntPoint, int32> IndexByCoord;
+	mutable bool bIndexDirty = true;
+
+	void EnsureIndex() const;
+};
+
+template <>
+struct TStructOpsTypeTraits<FDungeonChunkRegistry> : public TStructOpsTypeTraitsBase2<FDungeonChunkRegistry>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
@@ -6,6 +6,8 @@
 #include "Components/DynamicMeshComponent.h"
 #include "DungeonChunkStreamer.generated.h"
 
+struct FDungeonChunkRegistry;
+
 /**
  * 던전 청크 스트리밍 매니저
  * 카메라 위치를 기반으로 청크를 동적으로 로드/언로드하여 성능 최적화
@@ -24,14 +26,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
 	bool bEnableStreaming = false;
 
-	// 카메라로부터의 청크 활성화 거리 (청크 단위, 예: 3 = 카메라 주변 7x7 청크)
+	// 카메라로부터의 청크 활성화 거리 (청크 단위 원형 반경, 예: 3 = 카메라 청크 중심 반경 3.5 원 안의 37개 청크)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "1", ClampMax = "10"))
 	int32 StreamingDistance = 3;
 
+	// 비활성화 거리 여유 (청크 단위). 활성 청크는 StreamingDistance + 이 값을 벗어나야 숨겨짐 (경계 왕복 시 깜빡임 방지)
+	// 1.0이면 이동 중 뒤쪽 띠가 남아 활성 수가 정사각형 창과 비슷해짐 (반경 3 기준 평균 약 49개 vs 0.5일 때 약 42개)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.0", ClampMax = "3.0"))
+	float StreamingHysteresis = 0.5f;
+
 	// 스트리밍 업데이트 주기 (초)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.1", ClampMax = "5.0"))
 	float UpdateInterval = 0.5f;
 
+	// 프레임당 청크 렌더 가시성 전환에 쓸 시간 (ms). 최소 1개 청크는 처리
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.1", ClampMax = "16.0"))
+	float VisibilityBudgetMs = 1.0f;
+
+	// 프레임당 콜리전 전환에 쓸 시간 (ms). 렌더 전환 뒤에 따로 처리
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.1", ClampMax = "16.0"))
+	float CollisionBudgetMs = 0.5f;
+
+	// 이 시간(초) 이상 숨겨진 청크는 컴포넌트 등록 해제 (0이면 해제 안 함)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.0"))
+	float UnregisterHiddenAfter = 10.0f;
+
 	// 청크 크기 (타일 단위) - DungeonFullTestActor에서 설정
 	UPROPERTY(BlueprintReadWrite, Category = "Streaming")
 	int32 ChunkSize = 10;
@@ -50,13 +69,6 @@ public:
 	UPROPERTY(Transient)
 	TMap<FIntPoint, UDynamicMeshComponent*> ChunkMergedMeshMap;
 
-	// 바닥/천장 HISM 청크 맵
-	UPROPERTY(Transient)
-	TMap<FIntPoint, UHierarchicalInstancedStaticMeshComponent*> ChunkFloorMap;
-
-	UPROPERTY(Transient)
-	TMap<FIntPoint, UHierarchicalInstancedStaticMeshComponent*> ChunkCeilingMap;
-
 	// --- 런타임 ---
 	
 	// 현재 활성화된 청크들
@@ -74,10 +86,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Streaming")
 	void UpdateActiveChunks(const FVector& CameraLocation);
 
-	// 특정 청크의 가시성 설정
+	// 특정 청크의 가시성 즉시 설정 (렌더 + 콜리전, 대기열 우회)
 	UFUNCTION(BlueprintCallable, Category = "Streaming")
 	void SetChunkVisible(FIntPoint ChunkCoord, bool bVisible);
 
+	// 청크 가시성 전환 예약 (다음 틱부터 예산 안에서 가까운/앞쪽 청크 먼저 처리)
+	UFUNCTION(BlueprintCallable, Category = "Streaming")
+	void RequestChunkVisible(FIntPoint ChunkCoord, bool bVisible);
+
+	// 대기 중인 전환 수 (렌더 + 콜리전)
+	UFUNCTION(BlueprintPure, Category = "Streaming|Debug")
+	int32 GetPendingTransitionCount() const { return PendingVisibility.Num() + PendingCollision.Num(); }
+
 	// 모든 청크 표시 (스트리밍 비활성화 시)
 	UFUNCTION(BlueprintCallable, Category = "Streaming")
 	void ShowAllChunks();
@@ -86,6 +106,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Streaming")
 	void ClearChunkData();
 
+	// 청크 레지스트리로 청크 맵 설정 (벽 HISM, 머지 메시)
+	void ApplyChunkRegistry(const FDungeonChunkRegistry& Registry);
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -93,6 +116,82 @@ private:
 	// 월드 위치를 청크 좌표로 변환
 	FIntPoint WorldToChunkCoord(const FVector& WorldLocation) const;
 
+	// 월드 위치를 청크 단위 실수 좌표로 변환 (우선순위 계산용)
+	FVector2D WorldToChunkPosition(const FVector& WorldLocation) const;
+
 	// 카메라 위치 가져오기
 	FVector GetCameraLocation() const;
+
+	// 카메라 앞 방향 (수평)
+	FVector GetCameraForward() const;
+
+	// 청크 구성 컴포넌트 순회 (벽 HISM, 머지 메시)
+	template <typename FuncType>
+	void ForEachChunkComponent(FIntPoint ChunkCoord, FuncType&& Func) const;
+
+	// 렌더 가시성만 적용 (등록 해제된 청크는 다시 등록)
+	void ApplyChunkRendering(FIntPoint ChunkCoord, bool bVisible);
+
+	// 콜리전만 적용 (벽 HISM, 머지 메시)
+	void ApplyChunkCollision(FIntPoint ChunkCoord, bool bVisible);
+
+	// 전환 우선순위 큐 (최소 힙). 예약할 때 넣고, 카메라가 크게 움직였을 때만 다시 계산
+	struct FTransitionQueue
+	{
+		TArray<TPair<float, FIntPoint>> Heap;
+
+		// 앞쪽 가중치 (0이면 거리순)
+		float FacingWeight = 0.0f;
+
+		// 힙 우선순위를 계산할 때 쓴 카메라 상태
+		FVector2D BuiltCameraPosition = FVector2D::ZeroVector;
+		FVector2D BuiltCameraForward = FVector2D(1.0f, 0.0f);
+	};
+
+	// 큐 기준 카메라에서 본 전환 우선순위 (작을수록 먼저)
+	float GetTransitionPriority(const FTransitionQueue& Queue, FIntPoint ChunkCoord, bool bVisible) const;
+
+	// 전환 예약 (같은 목표가 이미 예약돼 있으면 무시)
+	void EnqueueTransition(TMap<FIntPoint, bool>& Pending, FTransitionQueue& Queue, FIntPoint ChunkCoord, bool bVisible);
+
+	// 카메라가 움직였거나 무효 항목이 쌓였으면 힙을 다시 구성
+	void RefreshTransitionQueue(FTransitionQueue& Queue, const TMap<FIntPoint, bool>& Pending);
+
+	// 예산 안에서 대기열 처리 (렌더 -> 콜리전 순)
+	void ProcessPendingTransitions();
+
+	// 오래 숨겨진 청크 등록 해제
+	void UnregisterStaleHiddenChunks(double CurrentTime);
+
+	// 예약된 가시성 (청크 -> 목표 상태, 최신 요청만 유지)
+	TMap<FIntPoint, bool> PendingVisibility;
+	TMap<FIntPoint, bool> PendingCollision;
+
+	// 숨긴 시각 (등록 해제 판정용) / 등록 해제된 청크
+	TMap<FIntPoint, double> HiddenSinceTimes;
+	TSet<FIntPoint> UnregisteredChunks;
+
+	// 우선순위 계산용 마지막 카메라 상태 (청크 단위 위치, 수평 앞 방향)
+	FVector2D PriorityCameraPosition = FVector2D::ZeroVector;
+	FVector2D PriorityCameraForward = FVector2D(1.0f, 0.0f);
+
+	// 렌더 / 콜리전 전환 큐 (Pending 맵이 실제 목표 상태, 힙에는 무효 항목이 남을 수 있음)
+	FTransitionQueue VisibilityQueue;
+	FTransitionQueue CollisionQueue;
+
+	// 설정이 바뀌었으면 원형 창의 행별 반폭을 다시 계산 (바뀌었으면 true)
+	bool RebuildWindowSpans();
+
+	// 현재 설정으로 활성 집합 전체를 다시 맞춤 (첫 실행 이후 설정 변경 시)
+	void ResyncActiveChunks();
+
+	// 마지막으로 스트리밍 창을 계산한 카메라 청크
+	FIntPoint StreamingCenter = FIntPoint::ZeroValue;
+	bool bHasStreamingCenter = false;
+
+	// 원형 창의 행별 반폭 (인덱스 = DY + 반경). 진입 원 / 이탈 원(히스테리시스 포함)
+	TArray<int32> EnterHalfWidths;
+	TArray<int32> LeaveHalfWidths;
+	int32 CachedStreamingDistance = -1;
+	float CachedHysteresis = -1.0f;
 };
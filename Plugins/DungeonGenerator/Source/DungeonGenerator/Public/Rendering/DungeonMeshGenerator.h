@@ -49,10 +49,24 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
   bool bGenerateFloor = true;
 
+  // 벽 메시 청크 하나가 담당하는 셀 수 (한 변). 청크마다 별도 컴포넌트라
+  // 바운드 단위로 컬링됨
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+            meta = (ClampMin = "4"))
+  int32 WallChunkSize = 32;
+
+  // 마지막 생성 결과의 청크 좌표 -> 벽 메시 컴포넌트 (WallMeshComponent에
+  // 부착, 다음 GenerateCaveWalls에서 파괴 후 다시 생성)
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient,
+            Category = "Dungeon Rendering")
+  TMap<FIntPoint, UProceduralMeshComponent *> WallChunkComponents;
+
   /**
    * Cellular Automata 던전의 동굴 벽 생성
+   * 청크별 메시를 병렬로 만들고 (청크 안에서는 셀 경계 정점 공유),
+   * 청크마다 WallMeshComponent 아래에 컴포넌트를 하나씩 붙임
    * @param Grid - 던전 그리드
-   * @param WallMeshComponent - 벽 프로시저럴 메시 컴포넌트
+   * @param WallMeshComponent - 벽 청크 컴포넌트의 부모 (자체 섹션은 비움)
    * @param FloorMeshComponent - 바닥 메시 컴포넌트 (선택)
    * @param CeilingMeshComponent - 천장 메시 컴포넌트 (선택)
    */
@@ -72,18 +86,6 @@ public:
                                 const FDungeonGrid &Grid) const;
 
 private:
-  // Marching Squares 지오메트리 생성
-  void GenerateMarchingSquareGeometry(TArray<FVector> &Vertices,
-                                      TArray<int32> &Triangles,
-                                      TArray<FVector2D> &UVs,
-                                      TArray<FVector> &Normals, int32 X,
-                                      int32 Y, uint8 Config);
-
-  // 노멀 스무딩 적용
-  void ApplySmoothNormals(TArray<FVector> &Normals,
-                          const TArray<FVector> &Vertices,
-                          const TArray<int32> &Triangles);
-
   // 바닥 메시 생성
   void GenerateFloorMesh(const FDungeonGrid &Grid,
                          UProceduralMeshComponent *FloorMeshComponent);
@@ -94,8 +96,4 @@ private:
 
   // 타일이 벽인지 확인
   bool IsWall(int32 X, int32 Y, const FDungeonGrid &Grid) const;
-
-  // 보간된 정점 위치 계산
-  FVector GetInterpolatedVertex(int32 X, int32 Y, bool bVertical,
-                                float T) const;
 };
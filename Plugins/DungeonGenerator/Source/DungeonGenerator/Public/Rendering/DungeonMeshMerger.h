@@ -7,6 +7,24 @@
 
 class UDynamicMesh;
 
+/**
+ * 청크 병합 옵션 (워커 스레드에서 적용)
+ */
+struct FDungeonChunkMergeOptions
+{
+	// 인접 인스턴스 사이의 겹치는 경계 엣지 용접
+	bool bWeldEdges = true;
+
+	// 동일 평면 삼각형 단순화 (경계/UV 이음새 유지)
+	bool bSimplifyPlanar = true;
+
+	// 평면 판정 각도 허용치 (도)
+	double PlanarAngleToleranceDeg = 0.1;
+
+	// 머지 컴포넌트에 콜리전 생성 (Complex as Simple)
+	bool bBuildCollision = true;
+};
+
 /**
  * 던전 청크 메시 병합 유틸리티
  * GeometryScript를 사용하여 런타임에 HISM 인스턴스들을 단일 메시로 병합
@@ -55,16 +73,41 @@ public:
 	/**
 	 * 청크별로 HISM들을 각각의 DynamicMeshComponent로 병합
 	 * 컬링 효율을 유지하면서 드로우콜 감소
+	 * 청크 메시 구축은 워커 스레드에서 병렬로 수행하고 완료까지 대기
 	 * @param Owner - 컴포넌트를 생성할 Actor
 	 * @param ChunkHISMs - 청크 좌표별 HISM 배열 맵
 	 * @param BaseName - 생성할 컴포넌트 기본 이름
+	 * @param Options - 용접/단순화/콜리전 옵션
 	 * @return 청크 좌표별 머지된 DynamicMeshComponent 맵
 	 */
 	// Note: TMap<FIntPoint, TArray<...>>는 UFUNCTION 지원 안됨
 	static TMap<FIntPoint, UDynamicMeshComponent*> MergeHISMsPerChunk(
 		AActor* Owner,
 		const TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>>& ChunkHISMs,
-		const FString& BaseName);
+		const FString& BaseName,
+		const FDungeonChunkMergeOptions& Options = FDungeonChunkMergeOptions());
+
+	using FOnChunksMerged = TFunction<void(const TMap<FIntPoint, UDynamicMeshComponent*>&)>;
+
+	// 완료 시점에 결과가 아직 필요한지 (false면 컴포넌트를 만들지 않고 버림)
+	using FIsMergeCurrent = TFunction<bool()>;
+
+	/**
+	 * MergeHISMsPerChunk의 비동기 버전 (게임 스레드를 막지 않음)
+	 * 소스 메시 변환과 인스턴스 트랜스폼 스냅샷만 호출 시점에 게임 스레드에서 하고,
+	 * 청크 메시 구축은 워커 스레드에서, 컴포넌트 생성은 완료 후 게임 스레드에서 수행
+	 * Owner가 그 사이에 파괴되거나 IsCurrent가 false면 컴포넌트를 만들지 않고
+	 * OnComplete도 호출하지 않음
+	 * @param OnComplete - 게임 스레드에서 생성된 컴포넌트 맵과 함께 호출
+	 * @param IsCurrent - 컴포넌트 생성 직전 게임 스레드에서 확인 (없으면 항상 생성)
+	 */
+	static void MergeHISMsPerChunkAsync(
+		AActor* Owner,
+		const TMap<FIntPoint, TArray<UHierarchicalInstancedStaticMeshComponent*>>& ChunkHISMs,
+		const FString& BaseName,
+		FOnChunksMerged OnComplete,
+		FIsMergeCurrent IsCurrent = nullptr,
+		const FDungeonChunkMergeOptions& Options = FDungeonChunkMergeOptions());
 
     // --- Internal Optimized API (Uses Cache) ---
     // Key: UStaticMesh*, Value: UDynamicMesh*
@@ -81,6 +124,11 @@ public:
 		UDynamicMesh* OutMesh,
         FMeshCache& MeshCache);
 
+    // StaticMesh -> DynamicMesh 변환 (캐시에 없으면 변환 후 추가, 게임 스레드 전용)
+    static UDynamicMesh* GetSourceMeshWithCache(
+		UStaticMesh* StaticMesh,
+        FMeshCache& MeshCache);
+
     static void AppendStaticMeshInstancesWithCache(
 		UStaticMesh* StaticMesh,
 		const TArray<FTransform>& Transforms,
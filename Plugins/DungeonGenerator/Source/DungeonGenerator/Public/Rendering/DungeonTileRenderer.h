@@ -6,9 +6,22 @@
 #include "DungeonGrid.h"
 #include "DungeonTileRenderer.generated.h"
 
+struct FDungeonChunkRegistry;
+
+/**
+ * 벽 오토타일 방식
+ */
+UENUM(BlueprintType)
+enum class EDungeonWallAutotileMode : uint8 {
+  // 4방향 비트마스크 (마스크 16개, WallMeshTable)
+  Cardinal4 UMETA(DisplayName = "4-Dir (16 Masks)"),
+  // 8방향 블롭 (47 케이스 -> 조각 15개 + 회전, BlobWallMeshTable)
+  Blob47 UMETA(DisplayName = "8-Dir Blob (47 Cases)")
+};
+
 /**
  * Bitmasking 기반 BSP 던전 타일 렌더러
- * 4방향 이웃 검사를 통해 적절한 벽 메시를 자동 선택하고 배치
+ * 4방향(또는 8방향 블롭) 이웃 검사를 통해 적절한 벽 메시를 자동 선택하고 배치
  */
 UCLASS(BlueprintType)
 class DUNGEONGENERATOR_API UDungeonTileRenderer : public UObject {
@@ -26,6 +39,18 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wall Meshes")
   TMap<uint8, UStaticMesh *> WallMeshTable;
 
+  // 벽 오토타일 방식 (Blob47이면 BlobWallMeshTable 사용, 타일당 인스턴스 1개)
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wall Meshes")
+  EDungeonWallAutotileMode WallAutotileMode = EDungeonWallAutotileMode::Cardinal4;
+
+  // 블롭 조각 테이블 (회전 정규형 8방향 마스크 -> 메시)
+  // 키: 0, 1, 5, 7, 17, 21, 23, 29, 31, 85, 87, 95, 119, 127, 255
+  // 비트: N=1, NE=2, E=4, SE=8, S=16, SW=32, W=64, NW=128
+  // 나머지 케이스는 Yaw 90도 단위로 회전 배치되므로 메시 피봇은 타일 중심
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wall Meshes",
+            meta = (EditCondition = "WallAutotileMode == EDungeonWallAutotileMode::Blob47"))
+  TMap<uint8, UStaticMesh *> BlobWallMeshTable;
+
   // 천장 메시
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ceiling")
   UStaticMesh *CeilingMesh;
@@ -141,6 +166,17 @@ public:
                                   UHierarchicalInstancedStaticMeshComponent *FloorHISM,
                                   TArray<UHierarchicalInstancedStaticMeshComponent*>& OutCreatedHISMs);
 
+  /**
+   * 위와 같음 + 생성한 벽 HISM을 청크 레지스트리에 기록 (OutRegistry가 있으면
+   * 초기화 후 채움). 로드 후 이름/태그 파싱 없이 청크 맵 복구용
+   */
+  void GenerateBSPTilesMultiMesh(const FDungeonGrid &Grid,
+                                  AActor* OwnerActor,
+                                  UHierarchicalInstancedStaticMeshComponent *CeilingHISM,
+                                  UHierarchicalInstancedStaticMeshComponent *FloorHISM,
+                                  TArray<UHierarchicalInstancedStaticMeshComponent*>& OutCreatedHISMs,
+                                  FDungeonChunkRegistry* OutRegistry);
+
   /**
    * 테마 에셋의 설정을 렌더러에 적용
    * @param Theme - 적용할 테마 에셋
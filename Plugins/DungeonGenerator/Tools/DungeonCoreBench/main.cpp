@@ -0,0 +1,550 @@
+// DungeonCore 벤치마크 / 결정성 검사 (엔진 없이 실행)
+//
+//   DungeonCoreBench [--sizes 64,128,256] [--seeds 8] [--floors 4]
+//                    [--threads N] [--algorithms bsp,multifloor]
+//   DungeonCoreBench --verify golden.txt
+//   DungeonCoreBench --write-golden golden.txt [스윕 옵션]
+//
+// 난수는 FRandomStream과 같은 알고리즘이라 같은 시드면 에디터 결과와 동일
+
+#include "CoreBSPGenerator.h"
+#include "CoreExecutor.h"
+#include "CoreObjectPlacer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace DungeonCore;
+
+//-------------------------------------------------------------------------
+// 할당 카운터 (전역 operator new 교체)
+//-------------------------------------------------------------------------
+namespace {
+std::atomic<uint64_t> GAllocCount{0};
+std::atomic<uint64_t> GAllocBytes{0};
+} // namespace
+
+void *operator new(std::size_t Size) {
+  GAllocCount.fetch_add(1, std::memory_order_relaxed);
+  GAllocBytes.fetch_add(Size, std::memory_order_relaxed);
+  if (void *Ptr = std::malloc(Size ? Size : 1)) {
+    return Ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t Size) { return ::operator new(Size); }
+
+void *operator new(std::size_t Size, const std::nothrow_t &) noexcept {
+  GAllocCount.fetch_add(1, std::memory_order_relaxed);
+  GAllocBytes.fetch_add(Size, std::memory_order_relaxed);
+  return std::malloc(Size ? Size : 1);
+}
+
+void *operator new[](std::size_t Size, const std::nothrow_t &Tag) noexcept {
+  return ::operator new(Size, Tag);
+}
+
+void operator delete(void *Ptr) noexcept { std::free(Ptr); }
+void operator delete[](void *Ptr) noexcept { std::free(Ptr); }
+void operator delete(void *Ptr, std::size_t) noexcept { std::free(Ptr); }
+void operator delete[](void *Ptr, std::size_t) noexcept { std::free(Ptr); }
+
+namespace {
+
+//-------------------------------------------------------------------------
+// FRandomStream 호환 난수 (플랫폼/컴파일러 무관하게 같은 수열)
+//-------------------------------------------------------------------------
+class BenchRandom : public IRandom {
+public:
+  explicit BenchRandom(int32_t InSeed) { Init(InSeed); }
+
+  virtual void Init(int32_t InSeed) override {
+    InitialSeed = InSeed;
+    Seed = (uint32_t)InSeed;
+  }
+
+  virtual int32_t GetInitialSeed() const override { return InitialSeed; }
+
+  virtual float GetFraction() override {
+    Seed = Seed * 196314165u + 907633515u;
+    const uint32_t Bits = 0x3F800000u | (Seed >> 9);
+    float Result;
+    std::memcpy(&Result, &Bits, sizeof(Result));
+    return Result - 1.0f;
+  }
+
+  virtual int32_t RandRange(int32_t Min, int32_t Max) override {
+    const int32_t Range = (Max - Min) + 1;
+    if (Range <= 0) {
+      return Min;
+    }
+    const int32_t Value = (int32_t)(GetFraction() * (float)Range);
+    return Min + (Value < Range - 1 ? Value : Range - 1);
+  }
+
+  virtual std::unique_ptr<IRandom> CreateChild(int32_t InSeed) const override {
+    return std::make_unique<BenchRandom>(InSeed);
+  }
+
+private:
+  int32_t InitialSeed = 0;
+  uint32_t Seed = 0;
+};
+
+// 경고/에러 개수만 세는 로거 (-v면 출력)
+class BenchLogger : public ILogger {
+public:
+  bool bVerbose = false;
+  std::atomic<int32_t> NumWarnings{0};
+  std::atomic<int32_t> NumErrors{0};
+
+  virtual void LogInfo(const char *Format, ...) override {
+    va_list Args;
+    va_start(Args, Format);
+    Print("Info", Format, Args);
+    va_end(Args);
+  }
+
+  virtual void LogWarning(const char *Format, ...) override {
+    ++NumWarnings;
+    va_list Args;
+    va_start(Args, Format);
+    Print("Warning", Format, Args);
+    va_end(Args);
+  }
+
+  virtual void LogError(const char *Format, ...) override {
+    ++NumErrors;
+    va_list Args;
+    va_start(Args, Format);
+    Print("Error", Format, Args);
+    va_end(Args);
+  }
+
+private:
+  void Print(const char *Level, const char *Format, va_list Args) {
+    if (!bVerbose) {
+      return;
+    }
+    std::fprintf(stderr, "[%s] ", Level);
+    std::vfprintf(stderr, Format, Args);
+    std::fprintf(stderr, "\n");
+  }
+};
+
+//-------------------------------------------------------------------------
+// 해시 (FNV-1a 64)
+//-------------------------------------------------------------------------
+struct Hasher {
+  uint64_t Value = 1469598103934665603ull;
+
+  void Add(const void *Data, size_t Size) {
+    const uint8_t *Bytes = static_cast<const uint8_t *>(Data);
+    for (size_t i = 0; i < Size; i++) {
+      Value ^= Bytes[i];
+      Value *= 1099511628211ull;
+    }
+  }
+
+  void Add(int32_t V) { Add(&V, sizeof(V)); }
+};
+
+void HashGrid(Hasher &H, const CoreDungeonGrid &Grid) {
+  H.Add(Grid.Width);
+  H.Add(Grid.Height);
+  for (int32_t Y = 0; Y < Grid.Height; Y++) {
+    for (int32_t X = 0; X < Grid.Width; X++) {
+      H.Add((int32_t)Grid.GetType(X, Y));
+      H.Add(Grid.GetRoomID(X, Y));
+      H.Add(Grid.GetStairTarget(X, Y));
+      // 컴파일러별 부동소수 오차를 피하려고 양자화
+      H.Add((int32_t)(Grid.GetSuitability(X, Y) * 65536.0f + 0.5f));
+    }
+  }
+}
+
+//-------------------------------------------------------------------------
+// 단계별 측정
+//-------------------------------------------------------------------------
+struct StageStats {
+  double Ms = 0.0;
+  uint64_t Allocs = 0;
+  uint64_t Bytes = 0;
+};
+
+class StageTimer {
+public:
+  explicit StageTimer(StageStats &InStats)
+      : Stats(InStats), Start(std::chrono::steady_clock::now()),
+        StartAllocs(GAllocCount.load()), StartBytes(GAllocBytes.load()) {}
+
+  ~StageTimer() {
+    const auto End = std::chrono::steady_clock::now();
+    Stats.Ms += std::chrono::duration<double, std::milli>(End - Start).count();
+    Stats.Allocs += GAllocCount.load() - StartAllocs;
+    Stats.Bytes += GAllocBytes.load() - StartBytes;
+  }
+
+private:
+  StageStats &Stats;
+  std::chrono::steady_clock::time_point Start;
+  uint64_t StartAllocs;
+  uint64_t StartBytes;
+};
+
+struct BenchOptions {
+  std::vector<int32_t> Sizes = {64, 128, 256};
+  int32_t NumSeeds = 8;
+  int32_t NumFloors = 4;
+  int32_t NumThreads = 0;
+  std::vector<std::string> Algorithms = {"bsp", "multifloor"};
+  std::string VerifyPath;
+  std::string WriteGoldenPath;
+  bool bVerbose = false;
+};
+
+// 한 케이스 = 알고리즘 + 크기 + 시드
+struct BenchCase {
+  std::string Algorithm;
+  int32_t Size = 0;
+  int32_t Seed = 0;
+};
+
+struct CaseResult {
+  uint64_t Hash = 0;
+  std::vector<StageStats> Stages;
+  bool bOk = true;
+};
+
+const std::vector<CorePropConfig> &GetPropConfigs() {
+  static const std::vector<CorePropConfig> Configs = {
+      {ECorePropType::Chest, 0.2f, 1, 3.0f, 8.0f},
+      {ECorePropType::Barrel, 0.5f, 1, 1.0f, 2.0f},
+      {ECorePropType::Torch, 0.3f, 1, 2.0f, 5.0f},
+  };
+  return Configs;
+}
+
+const std::vector<const char *> &GetStageNames(const std::string &Algorithm) {
+  static const std::vector<const char *> BSPStages = {"generate", "zones",
+                                                      "props"};
+  static const std::vector<const char *> MultiFloorStages = {"sequential",
+                                                             "parallel"};
+  return Algorithm == "bsp" ? BSPStages : MultiFloorStages;
+}
+
+// 생성기는 시드 루프 밖에서 재사용 (노드 배열 재사용 효과 측정)
+struct BenchContext {
+  CoreBSPGenerator BSP;
+  CoreDungeonGrid Grid;
+  BenchLogger Logger;
+  std::unique_ptr<CoreThreadExecutor> Executor;
+};
+
+CaseResult RunCase(BenchContext &Context, const BenchCase &Case,
+                   const BenchOptions &Options) {
+  CaseResult Result;
+  Result.Stages.resize(GetStageNames(Case.Algorithm).size());
+  Hasher H;
+
+  if (Case.Algorithm == "bsp") {
+    BenchRandom Random(Case.Seed);
+    Context.Grid.Init(Case.Size, Case.Size, ETileType::Wall);
+    {
+      StageTimer Timer(Result.Stages[0]);
+      Context.BSP.Generate(Context.Grid, Random, &Context.Logger);
+    }
+    {
+      StageTimer Timer(Result.Stages[1]);
+      CoreObjectPlacer::CalculateMonsterZones(Context.Grid, 5.0f, 20,
+                                              &Context.Logger,
+                                              Context.Executor.get());
+    }
+    std::vector<CorePropData> Props;
+    {
+      StageTimer Timer(Result.Stages[2]);
+      Props = CoreObjectPlacer::GenerateProps(Context.Grid, GetPropConfigs(),
+                                              Random, true, &Context.Logger,
+                                              Context.Executor.get());
+    }
+
+    HashGrid(H, Context.Grid);
+    H.Add((int32_t)Props.size());
+    for (const CorePropData &Prop : Props) {
+      H.Add((int32_t)Prop.Type);
+      H.Add(Prop.X);
+      H.Add(Prop.Y);
+    }
+  } else if (Case.Algorithm == "multifloor") {
+    CoreMultiFloorConfig Config;
+    Config.NumFloors = Options.NumFloors;
+    Config.Width = Case.Size;
+    Config.Height = Case.Size;
+
+    CoreMultiFloorDungeon Sequential;
+    {
+      StageTimer Timer(Result.Stages[0]);
+      BenchRandom Random(Case.Seed);
+      Sequential = CoreBSPGenerator::GenerateMultiFloor(Config, Random,
+                                                        &Context.Logger);
+    }
+    CoreMultiFloorDungeon Parallel;
+    {
+      StageTimer Timer(Result.Stages[1]);
+      BenchRandom Random(Case.Seed);
+      Parallel = CoreBSPGenerator::GenerateMultiFloor(
+          Config, Random, &Context.Logger, Context.Executor.get());
+    }
+
+    for (const CoreDungeonGrid &Floor : Sequential.Floors) {
+      HashGrid(H, Floor);
+    }
+    for (const CoreStairPosition &Stair : Sequential.Stairs) {
+      H.Add(Stair.FloorIndex);
+      H.Add(Stair.X);
+      H.Add(Stair.Y);
+      H.Add(Stair.TargetFloor);
+    }
+
+    // 병렬 실행 결과는 순차 실행과 같아야 함
+    Hasher ParallelHash;
+    for (const CoreDungeonGrid &Floor : Parallel.Floors) {
+      HashGrid(ParallelHash, Floor);
+    }
+    Hasher SequentialFloorHash;
+    for (const CoreDungeonGrid &Floor : Sequential.Floors) {
+      HashGrid(SequentialFloorHash, Floor);
+    }
+    if (ParallelHash.Value != SequentialFloorHash.Value ||
+        Parallel.Stairs.size() != Sequential.Stairs.size()) {
+      std::fprintf(stderr,
+                   "MISMATCH multifloor %d seed %d: parallel result differs "
+                   "from sequential\n",
+                   Case.Size, Case.Seed);
+      Result.bOk = false;
+    }
+  } else {
+    std::fprintf(stderr, "Unknown algorithm: %s\n", Case.Algorithm.c_str());
+    Result.bOk = false;
+  }
+
+  Result.Hash = H.Value;
+  return Result;
+}
+
+//-------------------------------------------------------------------------
+// 골든 파일: "<algorithm> <size> <seed> <hash>" 한 줄에 하나, '#'은 주석
+//-------------------------------------------------------------------------
+struct GoldenEntry {
+  BenchCase Case;
+  uint64_t Hash = 0;
+};
+
+bool LoadGolden(const std::string &Path, int32_t &OutNumFloors,
+                std::vector<GoldenEntry> &OutEntries) {
+  std::ifstream File(Path);
+  if (!File) {
+    std::fprintf(stderr, "Failed to open golden file: %s\n", Path.c_str());
+    return false;
+  }
+
+  std::string Line;
+  while (std::getline(File, Line)) {
+    if (Line.empty()) {
+      continue;
+    }
+    std::istringstream Stream(Line);
+    if (Line[0] == '#') {
+      // "# floors N" 은 multifloor 케이스의 층 수
+      std::string Hash, Key;
+      if (Stream >> Hash >> Key && Key == "floors") {
+        Stream >> OutNumFloors;
+      }
+      continue;
+    }
+
+    GoldenEntry Entry;
+    std::string HashText;
+    if (!(Stream >> Entry.Case.Algorithm >> Entry.Case.Size >>
+          Entry.Case.Seed >> HashText)) {
+      std::fprintf(stderr, "Malformed golden line: %s\n", Line.c_str());
+      return false;
+    }
+    Entry.Hash = std::strtoull(HashText.c_str(), nullptr, 16);
+    OutEntries.push_back(Entry);
+  }
+  return true;
+}
+
+int32_t RunVerify(const BenchOptions &InOptions) {
+  BenchOptions Options = InOptions;
+  std::vector<GoldenEntry> Entries;
+  if (!LoadGolden(Options.VerifyPath, Options.NumFloors, Entries)) {
+    return 1;
+  }
+
+  BenchContext Context;
+  Context.Logger.bVerbose = Options.bVerbose;
+  Context.Executor = std::make_unique<CoreThreadExecutor>(Options.NumThreads);
+
+  int32_t NumFailed = 0;
+  for (const GoldenEntry &Entry : Entries) {
+    const CaseResult Result = RunCase(Context, Entry.Case, Options);
+    if (!Result.bOk || Result.Hash != Entry.Hash) {
+      std::fprintf(stderr, "FAIL %s %d %d: expected %016llx, got %016llx\n",
+                   Entry.Case.Algorithm.c_str(), Entry.Case.Size,
+                   Entry.Case.Seed, (unsigned long long)Entry.Hash,
+                   (unsigned long long)Result.Hash);
+      ++NumFailed;
+    }
+  }
+
+  std::printf("Determinism: %d / %d cases match %s\n",
+              (int)Entries.size() - NumFailed, (int)Entries.size(),
+              Options.VerifyPath.c_str());
+  return NumFailed == 0 ? 0 : 1;
+}
+
+int32_t RunSweep(const BenchOptions &Options) {
+  BenchContext Context;
+  Context.Logger.bVerbose = Options.bVerbose;
+  Context.Executor = std::make_unique<CoreThreadExecutor>(Options.NumThreads);
+
+  std::ofstream Golden;
+  if (!Options.WriteGoldenPath.empty()) {
+    Golden.open(Options.WriteGoldenPath);
+    if (!Golden) {
+      std::fprintf(stderr, "Failed to write golden file: %s\n",
+                   Options.WriteGoldenPath.c_str());
+      return 1;
+    }
+    Golden << "# DungeonCoreBench golden hashes (--write-golden)\n";
+    Golden << "# floors " << Options.NumFloors << "\n";
+  }
+
+  std::printf("%-11s %6s %-11s %10s %10s %10s\n", "algorithm", "size",
+              "stage", "avg ms", "allocs", "KiB");
+
+  bool bAllOk = true;
+  for (const std::string &Algorithm : Options.Algorithms) {
+    const std::vector<const char *> &StageNames = GetStageNames(Algorithm);
+    for (const int32_t Size : Options.Sizes) {
+      std::vector<StageStats> Totals(StageNames.size());
+      Hasher Combined;
+
+      for (int32_t Seed = 0; Seed < Options.NumSeeds; Seed++) {
+        const BenchCase Case{Algorithm, Size, Seed};
+        const CaseResult Result = RunCase(Context, Case, Options);
+        bAllOk &= Result.bOk;
+
+        for (size_t i = 0; i < Totals.size() && i < Result.Stages.size();
+             i++) {
+          Totals[i].Ms += Result.Stages[i].Ms;
+          Totals[i].Allocs += Result.Stages[i].Allocs;
+          Totals[i].Bytes += Result.Stages[i].Bytes;
+        }
+        Combined.Add(&Result.Hash, sizeof(Result.Hash));
+
+        if (Golden) {
+          char HashText[17];
+          std::snprintf(HashText, sizeof(HashText), "%016llx",
+                        (unsigned long long)Result.Hash);
+          Golden << Algorithm << " " << Size << " " << Seed << " " << HashText
+                 << "\n";
+        }
+      }
+
+      const double NumRuns = Options.NumSeeds > 0 ? Options.NumSeeds : 1;
+      for (size_t i = 0; i < Totals.size(); i++) {
+        std::printf("%-11s %6d %-11s %10.3f %10.1f %10.1f\n",
+                    Algorithm.c_str(), Size, StageNames[i],
+                    Totals[i].Ms / NumRuns, Totals[i].Allocs / NumRuns,
+                    Totals[i].Bytes / NumRuns / 1024.0);
+      }
+      std::printf("%-11s %6d %-11s %016llx\n", Algorithm.c_str(), Size,
+                  "hash", (unsigned long long)Combined.Value);
+    }
+  }
+
+  if (Context.Logger.NumErrors > 0) {
+    std::printf("Logger: %d errors, %d warnings\n",
+                Context.Logger.NumErrors.load(),
+                Context.Logger.NumWarnings.load());
+  }
+  return bAllOk ? 0 : 1;
+}
+
+std::vector<std::string> SplitList(const char *Text) {
+  std::vector<std::string> Items;
+  std::stringstream Stream(Text);
+  std::string Item;
+  while (std::getline(Stream, Item, ',')) {
+    if (!Item.empty()) {
+      Items.push_back(Item);
+    }
+  }
+  return Items;
+}
+
+void PrintUsage() {
+  std::printf(
+      "Usage: DungeonCoreBench [options]\n"
+      "  --sizes A,B,...       grid sizes (default 64,128,256)\n"
+      "  --seeds N             seeds per size (default 8)\n"
+      "  --floors N            floors for multifloor (default 4)\n"
+      "  --threads N           executor threads (default: hardware)\n"
+      "  --algorithms a,b      bsp, multifloor (default both)\n"
+      "  --verify FILE         compare hashes against golden file\n"
+      "  --write-golden FILE   write hashes of the sweep to FILE\n"
+      "  -v                    print generator logs\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  BenchOptions Options;
+
+  for (int i = 1; i < argc; i++) {
+    const char *Arg = argv[i];
+    const bool bHasValue = i + 1 < argc;
+
+    if (std::strcmp(Arg, "--sizes") == 0 && bHasValue) {
+      Options.Sizes.clear();
+      for (const std::string &Size : SplitList(argv[++i])) {
+        Options.Sizes.push_back(std::atoi(Size.c_str()));
+      }
+    } else if (std::strcmp(Arg, "--seeds") == 0 && bHasValue) {
+      Options.NumSeeds = std::atoi(argv[++i]);
+    } else if (std::strcmp(Arg, "--floors") == 0 && bHasValue) {
+      Options.NumFloors = std::atoi(argv[++i]);
+    } else if (std::strcmp(Arg, "--threads") == 0 && bHasValue) {
+      Options.NumThreads = std::atoi(argv[++i]);
+    } else if (std::strcmp(Arg, "--algorithms") == 0 && bHasValue) {
+      Options.Algorithms = SplitList(argv[++i]);
+    } else if (std::strcmp(Arg, "--verify") == 0 && bHasValue) {
+      Options.VerifyPath = argv[++i];
+    } else if (std::strcmp(Arg, "--write-golden") == 0 && bHasValue) {
+      Options.WriteGoldenPath = argv[++i];
+    } else if (std::strcmp(Arg, "-v") == 0) {
+      Options.bVerbose = true;
+    } else {
+      PrintUsage();
+      return std::strcmp(Arg, "--help") == 0 ? 0 : 1;
+    }
+  }
+
+  if (!Options.VerifyPath.empty()) {
+    return RunVerify(Options);
+  }
+  return RunSweep(Options);
+}
@@ -0,0 +1,87 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+
+#include "GsNetworkConditioner.h"
+
+namespace GsNet {
+namespace {
+struct FDelayedPacketLess {
+  template <typename T> bool operator()(const T &A, const T &B) const {
+    return A.ReleaseTime < B.ReleaseTime ||
+           (A.ReleaseTime == B.ReleaseTime && A.Sequence < B.Sequence);
+  }
+};
+} // namespace
+
+void FGsNetworkConditioner::Configure(
+    const FGsNetworkConditionSettings &InSettings, int32 SeedOffset) {
+  Settings = InSettings;
+  Random.Initialize(Settings.Seed + SeedOffset);
+}
+
+void FGsNetworkConditioner::Reset() {
+  Pending.Empty();
+  NextSequence = 0;
+  LastOrderedReleaseTime = 0.0;
+  BandwidthFreeTime = 0.0;
+}
+
+void FGsNetworkConditioner::Submit(TArray<uint8> &&Packet, double Now) {
+  FDelayedPacket Entry;
+  Entry.Sequence = NextSequence++;
+  Entry.Data = MoveTemp(Packet);
+
+  // 비활성 상태: 남은 패킷 뒤에 그대로 붙여서 순서만 유지
+  if (!Settings.bEnabled) {
+    Entry.ReleaseTime = FMath::Max(Now, LastOrderedReleaseTime);
+    Pending.HeapPush(MoveTemp(Entry), FDelayedPacketLess());
+    return;
+  }
+
+  // 1. 손실
+  if (Settings.LossPercent > 0.0f &&
+      Random.FRand() * 100.0f < Settings.LossPercent) {
+    return;
+  }
+
+  // 2. 지연 + 지터
+  double Delay = Settings.LatencyMs * 0.001;
+  if (Settings.JitterMs > 0.0f) {
+    Delay += Random.FRand() * Settings.JitterMs * 0.001;
+  }
+  double ReleaseTime = Now + Delay;
+
+  // 3. 대역폭 (직렬화 시간만큼 링크 점유)
+  if (Settings.BandwidthKbps > 0) {
+    const double BytesPerSecond = Settings.BandwidthKbps * 1000.0 / 8.0;
+    const double Start = FMath::Max(Now, BandwidthFreeTime);
+    BandwidthFreeTime = Start + Entry.Data.Num() / BytesPerSecond;
+    ReleaseTime = FMath::Max(ReleaseTime, BandwidthFreeTime + Delay);
+  }
+
+  // 4. 순서: 재정렬 대상이 아니면 앞선 패킷보다 먼저 나가지 않도록 맞춤
+  const bool bReorder = Settings.ReorderPercent > 0.0f &&
+                        Random.FRand() * 100.0f < Settings.ReorderPercent;
+  if (!bReorder) {
+    ReleaseTime = FMath::Max(ReleaseTime, LastOrderedReleaseTime);
+    LastOrderedReleaseTime = ReleaseTime;
+  }
+
+  Entry.ReleaseTime = ReleaseTime;
+  Pending.HeapPush(MoveTemp(Entry), FDelayedPacketLess());
+}
+
+bool FGsNetworkConditioner::Pop(double Now, TArray<uint8> &OutPacket) {
+  if (Pending.Num() == 0) {
+    return false;
+  }
+
+  if (Pending.HeapTop().ReleaseTime > Now) {
+    return false;
+  }
+
+  FDelayedPacket Entry;
+  Pending.HeapPop(Entry, FDelayedPacketLess(), EAllowShrinking::No);
+  OutPacket = MoveTemp(Entry.Data);
+  return true;
+}
+} // namespace GsNet
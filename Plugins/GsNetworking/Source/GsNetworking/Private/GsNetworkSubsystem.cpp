@@ -29,6 +29,13 @@ void UGsNetworkSubsystem::Tick(float DeltaTime) {
       }
     }
   }
+
+  // 녹화 재생 (라이브 패킷과 같은 Dispatcher 경로로 전달)
+  if (Replayer.IsPlaying()) {
+    Replayer.Advance(DeltaTime, [this](const TArray<uint8> &Packet) {
+      Dispatcher.Dispatch(Packet);
+    });
+  }
 }
 
 TStatId UGsNetworkSubsystem::GetStatId() const {
@@ -45,6 +52,9 @@ void UGsNetworkSubsystem::Connect(const FString &Ip, int32 Port,
     TUniquePtr<GsNet::FGsNetworkWorker> NewWorker =
         MakeUnique<GsNet::FGsNetworkWorker>();
     NewWorker->Start();
+    if (ConditionSettings.bEnabled) {
+      NewWorker->SetConditioner(ConditionSettings);
+    }
     NewWorker->Connect(Ip, Port);
     Workers.Add(SessionName, MoveTemp(NewWorker));
   } else {
@@ -53,6 +63,14 @@ void UGsNetworkSubsystem::Connect(const FString &Ip, int32 Port,
   }
 }
 
+bool UGsNetworkSubsystem::Reconnect(FName SessionName) {
+  if (TUniquePtr<GsNet::FGsNetworkWorker> *FoundWorker =
+          Workers.Find(SessionName)) {
+    return (*FoundWorker)->Reconnect();
+  }
+  return false;
+}
+
 void UGsNetworkSubsystem::Disconnect(FName SessionName) {
   if (TUniquePtr<GsNet::FGsNetworkWorker> *FoundWorker =
           Workers.Find(SessionName)) {
@@ -90,3 +108,39 @@ void UGsNetworkSubsystem::Send(const TArray<uint8> &PacketData,
 void UGsNetworkSubsystem::UnregisterHandler(uint16 PacketId) {
   Dispatcher.UnregisterHandler(PacketId);
 }
+
+void UGsNetworkSubsystem::SetNetworkConditioner(
+    const FGsNetworkConditionSettings &Settings) {
+  ConditionSettings = Settings;
+  for (auto &Pair : Workers) {
+    if (Pair.Value) {
+      Pair.Value->SetConditioner(Settings);
+    }
+  }
+}
+
+void UGsNetworkSubsystem::StartPacketRecording(const FString &FilePath,
+                                               FName SessionName) {
+  if (TUniquePtr<GsNet::FGsNetworkWorker> *FoundWorker =
+          Workers.Find(SessionName)) {
+    (*FoundWorker)->StartRecording(FilePath);
+  } else {
+    UE_LOG(LogTemp, Warning,
+           TEXT("[GsNet] StartPacketRecording: Session '%s' not found"),
+           *SessionName.ToString());
+  }
+}
+
+void UGsNetworkSubsystem::StopPacketRecording(FName SessionName) {
+  if (TUniquePtr<GsNet::FGsNetworkWorker> *FoundWorker =
+          Workers.Find(SessionName)) {
+    (*FoundWorker)->StopRecording();
+  }
+}
+
+bool UGsNetworkSubsystem::StartPacketReplay(const FString &FilePath,
+                                            float PlaybackSpeed) {
+  return Replayer.Load(FilePath, PlaybackSpeed);
+}
+
+void UGsNetworkSubsystem::StopPacketReplay() { Replayer.Reset(); }
@@ -47,6 +47,10 @@ namespace GsNet
 					// 이전 세션의 잔여 패킷 제거
 					TArray<uint8> DummyPacket;
 					while (RecvQueue.Dequeue(DummyPacket));
+					while (StagingRecvQueue.Dequeue(DummyPacket));
+					while (ConditionedSendQueue.Dequeue(DummyPacket));
+					InboundConditioner.Reset();
+					OutboundConditioner.Reset();
 
 					ConnectionTryStartTime = CurrentTime;
 					
@@ -75,6 +79,20 @@ namespace GsNet
 					bConnected = false;
 					bIsConnecting = false;
 				}
+				else if (Cmd.Type == FWorkerCommand::EType::SetConditioner)
+				{
+					// 방향별로 다른 난수열을 쓰도록 시드 오프셋 부여
+					InboundConditioner.Configure(Cmd.Conditioner, 0);
+					OutboundConditioner.Configure(Cmd.Conditioner, 1);
+				}
+				else if (Cmd.Type == FWorkerCommand::EType::StartRecording)
+				{
+					Recorder.Start(Cmd.FilePath, CurrentTime);
+				}
+				else if (Cmd.Type == FWorkerCommand::EType::StopRecording)
+				{
+					Recorder.Stop();
+				}
 			}
 
 			// 2. I/O 및 상태 처리
@@ -92,10 +110,24 @@ namespace GsNet
 				else
 				{
 					// Recv (여기서 Connecting -> Connected 상태 변화가 일어날 수 있음)
-					Session->TryRecv(RecvQueue);
+					if (NeedsRecvStaging())
+					{
+						PumpRecv(CurrentTime);
+					}
+					else
+					{
+						Session->TryRecv(RecvQueue);
+					}
 					
 					// Send
-					Session->TrySend(SendQueue);
+					if (OutboundConditioner.IsActive())
+					{
+						PumpSend(CurrentTime);
+					}
+					else
+					{
+						Session->TrySend(SendQueue);
+					}
 
 					// 상태 업데이트 후 다시 확인
 					State = Session->GetState();
@@ -146,6 +178,48 @@ namespace GsNet
 		*/
 	}
 
+	void FGsNetworkWorker::PumpRecv(double CurrentTime)
+	{
+		Session->TryRecv(StagingRecvQueue);
+
+		TArray<uint8> Packet;
+		while (StagingRecvQueue.Dequeue(Packet))
+		{
+			if (InboundConditioner.IsActive())
+			{
+				InboundConditioner.Submit(MoveTemp(Packet), CurrentTime);
+			}
+			else
+			{
+				Recorder.Write(CurrentTime, Packet);
+				RecvQueue.Enqueue(MoveTemp(Packet));
+			}
+		}
+
+		// 게임 스레드가 실제로 받는 시점 기준으로 녹화 (재생 시 같은 타이밍 재현)
+		while (InboundConditioner.Pop(CurrentTime, Packet))
+		{
+			Recorder.Write(CurrentTime, Packet);
+			RecvQueue.Enqueue(MoveTemp(Packet));
+		}
+	}
+
+	void FGsNetworkWorker::PumpSend(double CurrentTime)
+	{
+		// 암호화 전(평문) 단계에서 지연/손실 적용 -> TxNonce 순서는 그대로 유지
+		TArray<uint8> Packet;
+		while (SendQueue.Dequeue(Packet))
+		{
+			OutboundConditioner.Submit(MoveTemp(Packet), CurrentTime);
+		}
+		while (OutboundConditioner.Pop(CurrentTime, Packet))
+		{
+			ConditionedSendQueue.Enqueue(MoveTemp(Packet));
+		}
+
+		Session->TrySend(ConditionedSendQueue);
+	}
+
 	void FGsNetworkWorker::Stop()
 	{
 		bRun = false;
@@ -153,6 +227,7 @@ namespace GsNet
 
 	void FGsNetworkWorker::Exit()
 	{
+		Recorder.Stop();
 		Session->Finalize();
 	}
 
@@ -178,6 +253,9 @@ namespace GsNet
 
 	void FGsNetworkWorker::Connect(const FString& Ip, int32 Port)
 	{
+		LastIp = Ip;
+		LastPort = Port;
+
 		FWorkerCommand Cmd;
 		Cmd.Type = FWorkerCommand::EType::Connect;
 		Cmd.Ip = Ip;
@@ -185,6 +263,17 @@ namespace GsNet
 		CommandQueue.Enqueue(Cmd);
 	}
 
+	bool FGsNetworkWorker::Reconnect()
+	{
+		if (LastIp.IsEmpty())
+		{
+			return false;
+		}
+
+		Connect(LastIp, LastPort);
+		return true;
+	}
+
 	void FGsNetworkWorker::Disconnect()
 	{
 		FWorkerCommand Cmd;
@@ -192,6 +281,29 @@ namespace GsNet
 		CommandQueue.Enqueue(Cmd);
 	}
 
+	void FGsNetworkWorker::SetConditioner(const FGsNetworkConditionSettings& Settings)
+	{
+		FWorkerCommand Cmd;
+		Cmd.Type = FWorkerCommand::EType::SetConditioner;
+		Cmd.Conditioner = Settings;
+		CommandQueue.Enqueue(Cmd);
+	}
+
+	void FGsNetworkWorker::StartRecording(const FString& FilePath)
+	{
+		FWorkerCommand Cmd;
+		Cmd.Type = FWorkerCommand::EType::StartRecording;
+		Cmd.FilePath = FilePath;
+		CommandQueue.Enqueue(Cmd);
+	}
+
+	void FGsNetworkWorker::StopRecording()
+	{
+		FWorkerCommand Cmd;
+		Cmd.Type = FWorkerCommand::EType::StopRecording;
+		CommandQueue.Enqueue(Cmd);
+	}
+
 	void FGsNetworkWorker::EnqueueSendPacket(TArray<uint8>&& Packet)
 	{
 		SendQueue.Enqueue(MoveTemp(Packet));
@@ -0,0 +1,123 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+
+#include "GsPacketCapture.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+
+namespace GsNet {
+//-------------------------------------------------------------------------
+// FGsPacketRecorder Implementation
+//-------------------------------------------------------------------------
+bool FGsPacketRecorder::Start(const FString &FilePath, double Now) {
+  Stop();
+
+  Writer.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+  if (!Writer.IsValid()) {
+    UE_LOG(LogTemp, Error, TEXT("[GsNet] Failed to open capture file: %s"),
+           *FilePath);
+    return false;
+  }
+
+  uint32 Magic = PACKET_CAPTURE_MAGIC;
+  uint32 Version = PACKET_CAPTURE_VERSION;
+  *Writer << Magic;
+  *Writer << Version;
+
+  StartTime = Now;
+  RecordedCount = 0;
+
+  UE_LOG(LogTemp, Log, TEXT("[GsNet] Packet recording started: %s"),
+         *FilePath);
+  return true;
+}
+
+void FGsPacketRecorder::Stop() {
+  if (Writer.IsValid()) {
+    Writer->Close();
+    Writer.Reset();
+    UE_LOG(LogTemp, Log, TEXT("[GsNet] Packet recording stopped. Packets: %d"),
+           RecordedCount);
+  }
+}
+
+void FGsPacketRecorder::Write(double Now, const TArray<uint8> &Packet) {
+  if (!Writer.IsValid()) {
+    return;
+  }
+
+  double Time = Now - StartTime;
+  uint32 Size = (uint32)Packet.Num();
+  *Writer << Time;
+  *Writer << Size;
+  Writer->Serialize(const_cast<uint8 *>(Packet.GetData()), Size);
+  ++RecordedCount;
+}
+
+//-------------------------------------------------------------------------
+// FGsPacketReplayer Implementation
+//-------------------------------------------------------------------------
+bool FGsPacketReplayer::Load(const FString &FilePath, float InPlaybackSpeed) {
+  Reset();
+
+  TArray<uint8> FileData;
+  if (!FFileHelper::LoadFileToArray(FileData, *FilePath)) {
+    UE_LOG(LogTemp, Error, TEXT("[GsNet] Failed to load capture file: %s"),
+           *FilePath);
+    return false;
+  }
+
+  FMemoryReader Reader(FileData);
+  uint32 Magic = 0;
+  uint32 Version = 0;
+  Reader << Magic;
+  Reader << Version;
+  if (Magic != PACKET_CAPTURE_MAGIC || Version != PACKET_CAPTURE_VERSION) {
+    UE_LOG(LogTemp, Error,
+           TEXT("[GsNet] Invalid capture file: %s (Magic: %08x, Version: %u)"),
+           *FilePath, Magic, Version);
+    return false;
+  }
+
+  while (!Reader.AtEnd()) {
+    FRecord Record;
+    uint32 Size = 0;
+    Reader << Record.Time;
+    Reader << Size;
+    if (Reader.IsError() || Size > (uint32)(Reader.TotalSize() - Reader.Tell())) {
+      UE_LOG(LogTemp, Warning,
+             TEXT("[GsNet] Truncated capture file: %s (Records: %d)"),
+             *FilePath, Records.Num());
+      break;
+    }
+    Record.Data.SetNumUninitialized(Size);
+    Reader.Serialize(Record.Data.GetData(), Size);
+    Records.Add(MoveTemp(Record));
+  }
+
+  PlaybackSpeed = InPlaybackSpeed;
+  UE_LOG(LogTemp, Log, TEXT("[GsNet] Packet replay loaded: %s (Records: %d)"),
+         *FilePath, Records.Num());
+  return true;
+}
+
+void FGsPacketReplayer::Reset() {
+  Records.Empty();
+  Cursor = 0;
+  Clock = 0.0;
+}
+
+void FGsPacketReplayer::Advance(
+    float DeltaTime, TFunctionRef<void(const TArray<uint8> &)> OnPacket) {
+  if (PlaybackSpeed > 0.0f) {
+    Clock += (double)DeltaTime * PlaybackSpeed;
+  } else {
+    Clock = TNumericLimits<double>::Max();
+  }
+
+  while (Cursor < Records.Num() && Records[Cursor].Time <= Clock) {
+    OnPacket(Records[Cursor].Data);
+    ++Cursor;
+  }
+}
+} // namespace GsNet
@@ -0,0 +1,87 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "GsNetworkConditioner.generated.h"
+
+/**
+ * 로컬 네트워크 컨디셔너 설정 (나쁜 네트워크 흉내)
+ * 패킷 단위(복호화된 상태)로 적용되므로 암호화 Nonce 순서에는 영향 없음
+ */
+USTRUCT(BlueprintType)
+struct GSNETWORKING_API FGsNetworkConditionSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking")
+	bool bEnabled = false;
+
+	/** 단방향 고정 지연 (ms) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking", meta = (ClampMin = "0"))
+	float LatencyMs = 0.0f;
+
+	/** 지연 흔들림 (ms, 0 ~ JitterMs 균등 분포로 추가) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking", meta = (ClampMin = "0"))
+	float JitterMs = 0.0f;
+
+	/** 패킷 손실률 (%) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking", meta = (ClampMin = "0", ClampMax = "100"))
+	float LossPercent = 0.0f;
+
+	/** 순서 뒤바뀜 비율 (%) - 해당 패킷은 FIFO 보장 없이 지연만 적용 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking", meta = (ClampMin = "0", ClampMax = "100"))
+	float ReorderPercent = 0.0f;
+
+	/** 대역폭 제한 (kbps, 0 = 무제한) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking", meta = (ClampMin = "0"))
+	int32 BandwidthKbps = 0;
+
+	/** 난수 시드 (같은 시드 = 같은 손실/지터 패턴) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GsNetworking")
+	int32 Seed = 0;
+};
+
+namespace GsNet
+{
+	//-------------------------------------------------------------------------
+	// 네트워크 컨디셔너 (단방향 1개, 워커 스레드 전용)
+	//-------------------------------------------------------------------------
+	class GSNETWORKING_API FGsNetworkConditioner
+	{
+	public:
+		FGsNetworkConditioner() = default;
+
+		void Configure(const FGsNetworkConditionSettings& InSettings, int32 SeedOffset);
+		bool IsEnabled() const { return Settings.bEnabled; }
+
+		// 비활성화 직후에도 대기 중인 패킷이 남아 있으면 계속 거쳐야 순서가 유지됨
+		bool IsActive() const { return Settings.bEnabled || Pending.Num() > 0; }
+
+		// 대기 중인 패킷 모두 폐기 (재연결 시)
+		void Reset();
+
+		// 패킷 투입 (손실 판정 후 릴리즈 시각 예약)
+		void Submit(TArray<uint8>&& Packet, double Now);
+
+		// 릴리즈 시각이 지난 패킷 하나 꺼내기
+		bool Pop(double Now, TArray<uint8>& OutPacket);
+
+	private:
+		struct FDelayedPacket
+		{
+			double ReleaseTime = 0.0;
+			uint64 Sequence = 0; // 같은 시각이면 투입 순서 유지
+			TArray<uint8> Data;
+		};
+
+		FGsNetworkConditionSettings Settings;
+		FRandomStream Random;
+
+		TArray<FDelayedPacket> Pending; // ReleaseTime 기준 최소 힙
+		uint64 NextSequence = 0;
+		double LastOrderedReleaseTime = 0.0;
+		double BandwidthFreeTime = 0.0;
+	};
+}
@@ -7,6 +7,8 @@
 #include "Tickable.h"
 #include "GsNetworkWorker.h"
 #include "GsPacketDispatcher.h"
+#include "GsNetworkConditioner.h"
+#include "GsPacketCapture.h"
 #include "GsNetworkSubsystem.generated.h"
 
 /**
@@ -30,6 +32,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GsNetworking")
 	void Connect(const FString& Ip, int32 Port, FName SessionName = "Default");
 
+	// 마지막 Connect 주소로 재연결 (접속한 적 없으면 false)
+	UFUNCTION(BlueprintCallable, Category = "GsNetworking")
+	bool Reconnect(FName SessionName = "Default");
+
 	UFUNCTION(BlueprintCallable, Category = "GsNetworking")
 	void Disconnect(FName SessionName = "Default");
 
@@ -48,8 +54,32 @@ public:
 	
 	void UnregisterHandler(uint16 PacketId);
 
+	// 네트워크 컨디셔너 (모든 세션 + 이후 생성되는 세션에 적용)
+	UFUNCTION(BlueprintCallable, Category = "GsNetworking|Debug")
+	void SetNetworkConditioner(const FGsNetworkConditionSettings& Settings);
+
+	// 수신 패킷 녹화 (복호화된 패킷 + 수신 시각)
+	UFUNCTION(BlueprintCallable, Category = "GsNetworking|Debug")
+	void StartPacketRecording(const FString& FilePath, FName SessionName = "Default");
+
+	UFUNCTION(BlueprintCallable, Category = "GsNetworking|Debug")
+	void StopPacketRecording(FName SessionName = "Default");
+
+	// 녹화 파일 재생 (PlaybackSpeed: 1 = 원래 속도, 0 이하 = 즉시 전부)
+	UFUNCTION(BlueprintCallable, Category = "GsNetworking|Debug")
+	bool StartPacketReplay(const FString& FilePath, float PlaybackSpeed = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "GsNetworking|Debug")
+	void StopPacketReplay();
+
+	UFUNCTION(BlueprintPure, Category = "GsNetworking|Debug")
+	bool IsReplayingPackets() const { return Replayer.IsPlaying(); }
+
 private:
 	// 세션 이름별 워커 관리
 	TMap<FName, TUniquePtr<GsNet::FGsNetworkWorker>> Workers;
 	GsNet::FGsPacketDispatcher Dispatcher;
+
+	FGsNetworkConditionSettings ConditionSettings;
+	GsNet::FGsPacketReplayer Replayer;
 };
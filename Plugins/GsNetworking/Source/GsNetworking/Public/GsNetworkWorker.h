@@ -6,6 +6,8 @@
 #include "HAL/Runnable.h"
 #include "Containers/Queue.h"
 #include "GsSocketSession.h"
+#include "GsNetworkConditioner.h"
+#include "GsPacketCapture.h"
 
 namespace GsNet
 {
@@ -27,15 +29,26 @@ namespace GsNet
 
 		// 게임 스레드용 API (API for Game Thread)
 		void Connect(const FString& Ip, int32 Port);
+		bool Reconnect(); // 마지막 Connect 주소로 다시 연결
 		void Disconnect();
 		void EnqueueSendPacket(TArray<uint8>&& Packet);
 		bool DequeueRecvPacket(TArray<uint8>& OutPacket);
 
+		// 테스트/벤치마크용 (API for Testing)
+		void SetConditioner(const FGsNetworkConditionSettings& Settings);
+		void StartRecording(const FString& FilePath);
+		void StopRecording();
+
 		bool IsConnected() const;
 
 	private:
 		void CheckConnection(float DeltaTime);
 
+		// 컨디셔너/녹화를 거치는 송수신 (활성화된 경우에만 사용)
+		void PumpRecv(double CurrentTime);
+		void PumpSend(double CurrentTime);
+		bool NeedsRecvStaging() const { return InboundConditioner.IsActive() || Recorder.IsRecording(); }
+
 	private:
 		FRunnableThread* Thread = nullptr;
 		FGsSocketSession* Session = nullptr;
@@ -49,18 +62,31 @@ namespace GsNet
 		double ConnectionTryStartTime = 0.0;
 		bool bIsConnecting = false;
 
+		// 마지막 접속 주소 (게임 스레드 전용, Reconnect용)
+		FString LastIp;
+		int32 LastPort = 0;
+
 		// 명령 큐 (게임 스레드 -> 워커 스레드 요청)
 		struct FWorkerCommand
 		{
-			enum class EType { Connect, Disconnect };
+			enum class EType { Connect, Disconnect, SetConditioner, StartRecording, StopRecording };
 			EType Type;
 			FString Ip;
 			int32 Port;
+			FString FilePath;
+			FGsNetworkConditionSettings Conditioner;
 		};
 		TQueue<FWorkerCommand, EQueueMode::Mpsc> CommandQueue;
 
 		// 데이터 큐
 		TQueue<TArray<uint8>, EQueueMode::Mpsc> SendQueue;
 		TQueue<TArray<uint8>, EQueueMode::Spsc> RecvQueue;
+
+		// 컨디셔너/녹화 (워커 스레드 전용)
+		FGsNetworkConditioner InboundConditioner;
+		FGsNetworkConditioner OutboundConditioner;
+		FGsPacketRecorder Recorder;
+		TQueue<TArray<uint8>, EQueueMode::Spsc> StagingRecvQueue;
+		TQueue<TArray<uint8>, EQueueMode::Mpsc> ConditionedSendQueue;
 	};
 }
@@ -0,0 +1,71 @@
+// Copyright 2024. bak1210. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+namespace GsNet
+{
+	//-------------------------------------------------------------------------
+	// 패킷 캡처 파일 포맷 (리틀 엔디언)
+	// [Magic 'GSPC' (4)][Version (4)]
+	// { [Time (double, 녹화 시작 기준 초)][Size (uint32)][복호화된 패킷 (Size)] } ...
+	//-------------------------------------------------------------------------
+	static constexpr uint32 PACKET_CAPTURE_MAGIC = 0x43505347; // "GSPC"
+	static constexpr uint32 PACKET_CAPTURE_VERSION = 1;
+
+	//-------------------------------------------------------------------------
+	// 패킷 녹화기 (워커 스레드 전용)
+	// 게임 스레드로 넘어가는 복호화된 수신 패킷을 시각과 함께 기록
+	//-------------------------------------------------------------------------
+	class GSNETWORKING_API FGsPacketRecorder
+	{
+	public:
+		FGsPacketRecorder() = default;
+		~FGsPacketRecorder() { Stop(); }
+
+		bool Start(const FString& FilePath, double Now);
+		void Stop();
+		bool IsRecording() const { return Writer.IsValid(); }
+
+		void Write(double Now, const TArray<uint8>& Packet);
+
+	private:
+		TUniquePtr<FArchive> Writer;
+		double StartTime = 0.0;
+		int32 RecordedCount = 0;
+	};
+
+	//-------------------------------------------------------------------------
+	// 패킷 재생기 (게임 스레드 전용)
+	// 녹화 파일을 읽어 원래 간격(또는 배속)으로 Dispatcher에 다시 흘려보냄
+	//-------------------------------------------------------------------------
+	class GSNETWORKING_API FGsPacketReplayer
+	{
+	public:
+		FGsPacketReplayer() = default;
+
+		// PlaybackSpeed: 1 = 원래 속도, 2 = 2배속, 0 이하 = 다음 틱에 전부
+		bool Load(const FString& FilePath, float InPlaybackSpeed);
+		void Reset();
+
+		bool IsPlaying() const { return Cursor < Records.Num(); }
+		int32 GetNumRecords() const { return Records.Num(); }
+
+		// 재생 시각을 진행시키고 시각이 지난 패킷을 OnPacket으로 전달
+		void Advance(float DeltaTime, TFunctionRef<void(const TArray<uint8>&)> OnPacket);
+
+	private:
+		struct FRecord
+		{
+			double Time = 0.0;
+			TArray<uint8> Data;
+		};
+
+		TArray<FRecord> Records;
+		int32 Cursor = 0;
+		double Clock = 0.0;
+		float PlaybackSpeed = 1.0f;
+	};
+}
@@ -33,6 +33,11 @@ void UGsNetworkManager::Initialize(FSubsystemCollectionBase &Collection) {
                                       &UGsNetworkManager::HandleLoginRes);
     NetworkSubsystem->RegisterHandler((uint16)PacketType::S2C_USER_ENTER, this,
                                       &UGsNetworkManager::HandleUserEnter);
+    NetworkSubsystem->RegisterHandler((uint16)PacketType::S2C_WORLD_SNAPSHOT,
+                                      this,
+                                      &UGsNetworkManager::HandleWorldSnapshot);
+    NetworkSubsystem->RegisterHandler((uint16)PacketType::S2C_RESUME_RES, this,
+                                      &UGsNetworkManager::HandleResumeRes);
     NetworkSubsystem->RegisterHandler((uint16)PacketType::S2C_USER_LEAVE, this,
                                       &UGsNetworkManager::HandleUserLeave);
     NetworkSubsystem->RegisterHandler((uint16)PacketType::S2C_MOVE_BROADCAST,
@@ -66,6 +71,8 @@ void UGsNetworkManager::HandleLoginRes(const TArray<uint8> &Data) {
 
   if (Pkt->success) {
     MySessionId = Pkt->mySessionId;
+    FMemory::Memcpy(ResumeToken, Pkt->resumeToken, RESUME_TOKEN_SIZE);
+    bHasResumeToken = true;
     UE_LOG(LogTemp, Log,
            TEXT("[GsNetworkManager] Login Success. MySessionId: %d"),
            MySessionId);
@@ -80,25 +87,134 @@ void UGsNetworkManager::HandleLoginRes(const TArray<uint8> &Data) {
   }
 }
 
+bool UGsNetworkManager::ResumeSession() {
+  if (!bHasResumeToken)
+    return false;
+
+  UGsNetworkSubsystem *NetSubsystem =
+      GetGameInstance()->GetSubsystem<UGsNetworkSubsystem>();
+  if (!NetSubsystem || !NetSubsystem->Reconnect())
+    return false;
+
+  // 송신 큐가 핸드셰이크 완료를 기다리므로 바로 넣어도 됨
+  Pkt_ResumeReq ReqPkt;
+  ReqPkt.size = sizeof(Pkt_ResumeReq);
+  ReqPkt.type = (uint16)PacketType::C2S_RESUME_REQ;
+  ReqPkt.sessionId = MySessionId;
+  FMemory::Memcpy(ReqPkt.resumeToken, ResumeToken, RESUME_TOKEN_SIZE);
+
+  TArray<uint8> Buffer;
+  Buffer.AddUninitialized(sizeof(Pkt_ResumeReq));
+  FMemory::Memcpy(Buffer.GetData(), &ReqPkt, sizeof(Pkt_ResumeReq));
+  NetSubsystem->Send(Buffer);
+
+  UE_LOG(LogTemp, Log,
+         TEXT("[GsNetworkManager] Resume requested. MySessionId: %d"),
+         MySessionId);
+  return true;
+}
+
+void UGsNetworkManager::HandleResumeRes(const TArray<uint8> &Data) {
+  if (Data.Num() < sizeof(Pkt_ResumeRes))
+    return;
+  const Pkt_ResumeRes *Pkt =
+      reinterpret_cast<const Pkt_ResumeRes *>(Data.GetData());
+
+  if (Pkt->success) {
+    // 놓친 입장/퇴장은 이어서 WORLD_SNAPSHOT / USER_LEAVE로 들어옴
+    // 전체 동기화면 이어지는 스냅샷에 없는 원격 유저를 제거
+    if (Pkt->fullSync) {
+      ResyncStaleUsers.Reset();
+      RemoteActors.GetKeys(ResyncStaleUsers);
+      ResyncRemaining = (int32)Pkt->userCount;
+      bResyncing = true;
+      if (ResyncRemaining == 0) {
+        FinishResync();
+      }
+    }
+    UE_LOG(LogTemp, Log,
+           TEXT("[GsNetworkManager] Session resumed. MySessionId: %d "
+                "(FullSync: %d)"),
+           MySessionId, Pkt->fullSync ? 1 : 0);
+  } else {
+    // 유예 시간 만료: 서버에서 이미 퇴장 처리됨 -> 원격 액터 정리 후 재로그인
+    UE_LOG(LogTemp, Warning,
+           TEXT("[GsNetworkManager] Resume Failed. Login required."));
+    bHasResumeToken = false;
+    for (auto &Pair : RemoteActors) {
+      if (Pair.Value) {
+        Pair.Value->Destroy();
+      }
+    }
+    RemoteActors.Empty();
+  }
+
+  if (OnResumeResult.IsBound()) {
+    OnResumeResult.Broadcast(Pkt->success);
+  }
+}
+
 void UGsNetworkManager::HandleUserEnter(const TArray<uint8> &Data) {
   if (Data.Num() < sizeof(Pkt_UserEnter))
     return;
   const Pkt_UserEnter *Pkt =
       reinterpret_cast<const Pkt_UserEnter *>(Data.GetData());
 
+  SpawnRemoteUser(Pkt->sessionId, FVector(Pkt->x, Pkt->y, Pkt->z), Pkt->yaw);
+}
+
+void UGsNetworkManager::HandleWorldSnapshot(const TArray<uint8> &Data) {
+  if (Data.Num() < sizeof(Pkt_WorldSnapshot))
+    return;
+  const Pkt_WorldSnapshot *Pkt =
+      reinterpret_cast<const Pkt_WorldSnapshot *>(Data.GetData());
+
+  const int32 Count = Pkt->count;
+  if (Data.Num() < (int32)(sizeof(Pkt_WorldSnapshot) +
+                           Count * sizeof(SnapshotEntry))) {
+    UE_LOG(LogTemp, Warning,
+           TEXT("[GsNetworkManager] Truncated WorldSnapshot (Count: %d, "
+                "Size: %d)"),
+           Count, Data.Num());
+    return;
+  }
+
+  // 엔트리는 패킹되어 있으므로 정렬 보장 없이 복사해서 읽음
+  const uint8 *Cursor = Data.GetData() + sizeof(Pkt_WorldSnapshot);
+  for (int32 i = 0; i < Count; ++i, Cursor += sizeof(SnapshotEntry)) {
+    SnapshotEntry Entry;
+    FMemory::Memcpy(&Entry, Cursor, sizeof(SnapshotEntry));
+    SpawnRemoteUser(Entry.sessionId, FVector(Entry.x, Entry.y, Entry.z),
+                    Entry.yaw);
+
+    if (bResyncing && ResyncRemaining > 0) {
+      ResyncStaleUsers.Remove(Entry.sessionId);
+      --ResyncRemaining;
+    }
+  }
+
+  if (bResyncing && ResyncRemaining == 0) {
+    FinishResync();
+  }
+
+  UE_LOG(LogTemp, Log,
+         TEXT("[GsNetworkManager] WorldSnapshot received. Users: %d"), Count);
+}
+
+void UGsNetworkManager::SpawnRemoteUser(uint32 SessionId,
+                                        const FVector &SpawnLoc, float Yaw) {
   // 1. 내꺼면 무시
-  if (Pkt->sessionId == MySessionId)
+  if (SessionId == MySessionId)
     return;
 
   // 2. 이미 있으면 무시
-  if (RemoteActors.Contains(Pkt->sessionId))
+  if (RemoteActors.Contains(SessionId))
     return;
 
   // 3. 스폰
   UWorld *World = GetWorld();
   if (World) {
-    FVector SpawnLoc(Pkt->x, Pkt->y, Pkt->z);
-    FRotator SpawnRot(0, Pkt->yaw, 0);
+    FRotator SpawnRot(0, Yaw, 0);
     FActorSpawnParameters SpawnParams;
     SpawnParams.SpawnCollisionHandlingOverride =
         ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
@@ -107,19 +223,19 @@ void UGsNetworkManager::HandleUserEnter(const TArray<uint8> &Data) {
                                                  SpawnRot, SpawnParams);
     if (NewActor) {
       if (ARdRemoteCharacter *RemoteChar = Cast<ARdRemoteCharacter>(NewActor)) {
-        RemoteChar->SetSessionId(Pkt->sessionId);
+        RemoteChar->SetSessionId(SessionId);
         // 필드 스폰이므로 CustomTCP 모드 강제 설정
         RemoteChar->SetNetworkDriverMode(ENetworkDriverMode::CustomTCP);
 
         UE_LOG(LogTemp, Log,
                TEXT("[GsNetworkManager] Initialized RemoteCharacter %d "
                     "(CustomTCP Mode)"),
-               Pkt->sessionId);
+               SessionId);
       }
 
-      RemoteActors.Add(Pkt->sessionId, NewActor);
+      RemoteActors.Add(SessionId, NewActor);
       UE_LOG(LogTemp, Log, TEXT("[GsNetworkManager] Spawned User %d at %s"),
-             Pkt->sessionId, *SpawnLoc.ToString());
+             SessionId, *SpawnLoc.ToString());
 
       // RemoteChar는 AI 컨트롤러가 필요 없음 (직접 보간)
     }
@@ -132,15 +248,28 @@ void UGsNetworkManager::HandleUserLeave(const TArray<uint8> &Data) {
   const Pkt_UserLeave *Pkt =
       reinterpret_cast<const Pkt_UserLeave *>(Data.GetData());
 
-  if (AActor **FoundActor = RemoteActors.Find(Pkt->sessionId)) {
+  RemoveRemoteUser(Pkt->sessionId);
+}
+
+void UGsNetworkManager::RemoveRemoteUser(uint32 SessionId) {
+  if (AActor **FoundActor = RemoteActors.Find(SessionId)) {
     if (*FoundActor) {
       (*FoundActor)->Destroy();
     }
-    RemoteActors.Remove(Pkt->sessionId);
+    RemoteActors.Remove(SessionId);
     UE_LOG(LogTemp, Log,
            TEXT("[GsNetworkManager] User %d Left. Destroyed Actor."),
-           Pkt->sessionId);
+           SessionId);
+  }
+}
+
+void UGsNetworkManager::FinishResync() {
+  // 끊긴 동안 퇴장한 유저 (서버 스냅샷에 없음)
+  for (uint32 StaleId : ResyncStaleUsers) {
+    RemoveRemoteUser(StaleId);
   }
+  ResyncStaleUsers.Reset();
+  bResyncing = false;
 }
 
 void UGsNetworkManager::HandleMoveBroadcast(const TArray<uint8> &Data) {
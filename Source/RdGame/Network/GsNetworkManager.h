@@ -8,6 +8,7 @@
 
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLoginResult, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnResumeResult, bool, bSuccess);
 
 /**
  * 게임 내 네트워크 로직 처리 (패킷 핸들링, 액터 스폰/동기화)
@@ -30,13 +31,33 @@ public:
   UPROPERTY(BlueprintAssignable, Category = "Network")
   FOnLoginResult OnLoginResult;
 
+  // 세션 재개 결과 델리게이트 (실패 시 다시 로그인해야 함)
+  UPROPERTY(BlueprintAssignable, Category = "Network")
+  FOnResumeResult OnResumeResult;
+
+  // 끊긴 연결을 재접속 후 기존 세션으로 재개 (재로그인/월드 재전송 없음)
+  // 재개 토큰이 없거나 재접속할 주소가 없으면 false
+  UFUNCTION(BlueprintCallable, Category = "Network")
+  bool ResumeSession();
+
   // 패킷 핸들러
   void HandleLoginRes(const TArray<uint8> &Data);
   void HandleUserEnter(const TArray<uint8> &Data);
+  void HandleWorldSnapshot(const TArray<uint8> &Data);
+  void HandleResumeRes(const TArray<uint8> &Data);
   void HandleUserLeave(const TArray<uint8> &Data);
   void HandleMoveBroadcast(const TArray<uint8> &Data);
 
 private:
+  // 원격 플레이어 스폰 (USER_ENTER / WORLD_SNAPSHOT 공용)
+  void SpawnRemoteUser(uint32 SessionId, const FVector &SpawnLoc, float Yaw);
+
+  // 원격 플레이어 제거 (USER_LEAVE / 재개 전체 동기화 공용)
+  void RemoveRemoteUser(uint32 SessionId);
+
+  // 재개 전체 동기화 완료: 스냅샷에 없던 원격 플레이어 제거
+  void FinishResync();
+
   // 원격 플레이어 관리
   UPROPERTY()
   TMap<uint32, AActor *> RemoteActors;
@@ -44,6 +65,15 @@ private:
   // 내 세션 ID
   uint32 MySessionId = 0;
 
+  // 로그인 시 받은 재개 토큰 (서버 유예 시간 동안만 유효)
+  uint8 ResumeToken[RESUME_TOKEN_SIZE] = {};
+  bool bHasResumeToken = false;
+
+  // 재개 전체 동기화 중 (남은 스냅샷 엔트리 수, 아직 스냅샷에 안 나온 유저)
+  bool bResyncing = false;
+  int32 ResyncRemaining = 0;
+  TSet<uint32> ResyncStaleUsers;
+
   // 스폰할 액터 클래스 (BP 클래스 경로 로드 예정)
   TSubclassOf<AActor> RemoteActorClass;
 
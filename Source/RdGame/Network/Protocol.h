@@ -11,9 +11,15 @@ enum class PacketType : uint16_t {
   C2S_ATTACK = 5,         // 클라 -> 서버: 공격!
   S2C_ATTACK_BROADCAST = 6,
   S2C_USER_ENTER = 7, // 서버 -> 클라: 유저 입장 (내 정보 포함, 타인 정보 포함)
-  S2C_USER_LEAVE = 8  // 서버 -> 클라: 유저 퇴장
+  S2C_USER_LEAVE = 8, // 서버 -> 클라: 유저 퇴장
+  S2C_WORLD_SNAPSHOT = 9, // 서버 -> 클라: 기존 유저 일괄 전송 (로그인 직후)
+  C2S_RESUME_REQ = 10,    // 클라 -> 서버: 재접속 후 세션 재개 요청
+  S2C_RESUME_RES = 11     // 서버 -> 클라: 세션 재개 결과 (성공 시 델타 뒤따름)
 };
 
+// 세션 재개 토큰 크기 (로그인 응답으로 발급)
+static constexpr int RESUME_TOKEN_SIZE = 16;
+
 #pragma pack(push, 1) // 바이트 정렬 (네트워크 전송용)
 
 // 모든 패킷의 공통 헤더
@@ -31,6 +37,7 @@ struct Pkt_LoginReq : public PacketHeader {
 struct Pkt_LoginRes : public PacketHeader {
   uint32_t mySessionId;
   bool success;
+  uint8_t resumeToken[RESUME_TOKEN_SIZE]; // 재접속 시 Pkt_ResumeReq에 사용
 };
 
 // [이동] 데드 레코닝을 위한 데이터 구조
@@ -63,4 +70,36 @@ struct Pkt_UserLeave : public PacketHeader {
   uint32_t sessionId;
 };
 
+// [유저 관리] 월드 스냅샷 항목
+struct SnapshotEntry {
+  uint32_t sessionId;
+  float x, y, z;
+  float yaw;
+};
+
+// [유저 관리] 월드 스냅샷: 헤더 뒤에 SnapshotEntry가 count개 연속으로 붙음
+// 유저가 많아 한 프레임(size: uint16)에 다 들어가지 않으면 여러 개로 나눠 전송
+struct Pkt_WorldSnapshot : public PacketHeader {
+  uint16_t count;
+  // SnapshotEntry entries[count];
+};
+
+// [세션 재개] 요청: 끊기기 전 SessionId + 로그인 때 받은 토큰
+// (로그인 대신 전송, 핸드셰이크 직후 바로 보내므로 1 RTT)
+struct Pkt_ResumeReq : public PacketHeader {
+  uint32_t sessionId;
+  uint8_t resumeToken[RESUME_TOKEN_SIZE];
+};
+
+// [세션 재개] 응답: 성공 시 유예 중 놓친 입장(WORLD_SNAPSHOT)/퇴장(USER_LEAVE)만
+// 이어서 전송. 실패 시 클라이언트는 월드를 비우고 일반 로그인
+// fullSync: 끊김을 서버가 감지하기 전이라 델타가 없음. 이어지는 WORLD_SNAPSHOT
+// 엔트리 userCount개가 전체 월드이므로 클라이언트는 목록에 없는 원격 유저를 제거
+struct Pkt_ResumeRes : public PacketHeader {
+  uint32_t sessionId;
+  bool success;
+  bool fullSync;
+  uint32_t userCount;
+};
+
 #pragma pack(pop)